@@ -17,6 +17,8 @@ decheaders = Split("""
 hana_decode/THaUsrstrutils.h hana_decode/THaCrateMap.h
 hana_decode/THaCodaData.h hana_decode/THaEpics.h
 hana_decode/THaFastBusWord.h hana_decode/THaCodaFile.h
+hana_decode/THaCodaPrefetch.h hana_decode/THaCodaMmapFile.h hana_decode/THaCodaIndex.h
+hana_decode/THaProfiler.h
 hana_decode/THaSlotData.h hana_decode/THaEvData.h
 hana_decode/THaCodaDecoder.h hana_decode/SimDecoder.h
 hana_decode/CodaDecoder.h hana_decode/Module.h hana_decode/VmeModule.h
@@ -66,7 +68,9 @@ src/THaHelicity.h src/THaPhotoReaction.h src/THaSAProtonEP.h
 src/THaTextvars.h src/THaQWEAKHelicity.h src/THaQWEAKHelicityReader.h
 src/THaEvtTypeHandler.h src/THaScalerEvtHandler.h
 src/THaEpicsEvtHandler.h src/THaEvt125Handler.h src/THaVDCChamber.h
-src/THaVDCPoint.h src/THaVDCPointPair.h src/THaGlobals.h
+src/THaVDCPoint.h src/THaVDCPointPair.h src/THaOpticsReplay.h
+src/THaParallel.h
+src/THaGlobals.h
 src/HallA_LinkDef.h
 """)
 baseenv.RootCint(roothadict,haheaders)
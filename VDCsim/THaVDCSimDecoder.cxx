@@ -10,7 +10,7 @@
 
 #include "THaVDCSimDecoder.h"
 #include "THaVDCSim.h"
-#include "THaBenchmark.h"
+#include "THaProfiler.h"
 #include "VarDef.h"
 
 using namespace std;
@@ -112,11 +112,11 @@ int THaVDCSimDecoder::LoadEvent(const int* evbuffer )
     if (init_slotdata(map) == HED_ERR) return HED_ERR;
     first_decode = false;
   }
-  if( fDoBench ) fBench->Begin("clearEvent");
+  if( fDoBench ) fProfiler->Start(fProfKey[kProfClearEvent]);
   Clear();
   for( int i=0; i<fNSlotClear; i++ )
     crateslot[fSlotClear[i]]->clearEvent();
-  if( fDoBench ) fBench->Stop("clearEvent");
+  if( fDoBench ) fProfiler->Stop(fProfKey[kProfClearEvent]);
   
   evscaler = 0;
 
@@ -128,7 +128,7 @@ int THaVDCSimDecoder::LoadEvent(const int* evbuffer )
   event_num = simEvent->event_num;
   recent_event = event_num;
 
-  if( fDoBench ) fBench->Begin("physics_decode");
+  if( fDoBench ) fProfiler->Start(fProfKey[kProfPhysics]);
 
 
   // Decode the digitized data.  Populate crateslot array.
@@ -172,7 +172,7 @@ int THaVDCSimDecoder::LoadEvent(const int* evbuffer )
     fTracks.Add( track );
   }
 
-  if( fDoBench ) fBench->Stop("physics_decode");
+  if( fDoBench ) fProfiler->Stop(fProfKey[kProfPhysics]);
 
   // DEBUG:
   //  cout << "SimDecoder: nTracks = " << GetNTracks() << endl;
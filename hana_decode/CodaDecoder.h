@@ -31,6 +31,10 @@ public:
   Int_t roc_decode( Int_t roc, const UInt_t* evbuffer, Int_t ipt, Int_t istop );
   Int_t bank_decode( Int_t roc, const UInt_t* evbuffer, Int_t ipt, Int_t istop );
 
+  // Find slots via lookup table (default) or by trying each slot in turn
+  void   EnableSlotDispatch( Bool_t enable = kTRUE ) { fUseDispatch = enable; }
+  Bool_t SlotDispatchEnabled() const { return fUseDispatch; }
+
 protected:
   //  Int_t   synchflag; // unused
   //  Bool_t  buffmode,synchmiss,synchextra; // already defined in base class
@@ -39,6 +43,33 @@ protected:
   std::vector<Int_t> irn;
   std::vector<bool>  fbfound;
   std::vector<Int_t> psfact;
+  UInt_t fRocEager;  // Crates always decoded in LoadEvent (pipelining modules)
+
+  // Lookup table of the slots of a ROC, built from the crate map and
+  // the modules' header/mask. For each distinct mask, the sorted list of
+  // headers and the bit pattern of the slots having that header.
+  struct HeaderGroup_t {
+    UInt_t mask;
+    std::vector<UInt_t> header;
+    std::vector<UInt_t> slots;
+  };
+  struct RocDispatch_t {
+    UInt_t used;        // Bit pattern of used slots
+    Bool_t firstbank;   // First slot in scan order is read by bank_decode
+    std::vector<HeaderGroup_t> groups;
+    UInt_t Candidates( UInt_t word ) const;
+  };
+  std::vector<RocDispatch_t> fDispatch; // [MAXROC]
+  Bool_t fUseDispatch;                  // Use fDispatch in roc_decode
+
+  void  BuildDispatch();
+  Int_t LoadSlotsDispatch( Int_t roc, const UInt_t* p, const UInt_t* pstop,
+			   Int_t incrslot );
+  Int_t LoadSlotsScan( Int_t roc, const UInt_t* evbuffer, const UInt_t* p,
+		       const UInt_t* pstop, Int_t firstslot, Int_t incrslot );
+
+  virtual Int_t DecodeCrate( Int_t roc );
+  void  FindEagerRocs();
 
   void CompareRocs();
   void ChkFbSlot( Int_t roc, const UInt_t* evbuffer, Int_t ipt, Int_t istop );
@@ -56,6 +56,15 @@ namespace Decoder {
     Int_t GetNumEvents() const { return GetNumEvents(0); } ;
     Int_t GetNumEvents(Int_t ichan) const { return GetNumFadcEvents(ichan); } ;
     Int_t GetNumSamples(Int_t ichan) const { return GetNumFadcSamples(ichan, 0);};
+    // Direct access to the decoded data of the current event, without
+    // copying. Valid until the next call to LoadSlot or Clear.
+    Int_t GetChannelData(Decoder::EModuleType mtype, Int_t chan, const uint32_t*& data) const;
+    const uint32_t* GetModuleData(Decoder::EModuleType mtype, const uint32_t*& offsets) const;
+    // Software pulse processing of raw samples (modes 1 and 8). Results are
+    // returned as kPulseIntegral, kPulseTime, kPulsePeak and kPulsePedestal.
+    void SetWaveformProcessing(UInt_t tet, UInt_t nped = 4, UInt_t nsb = 0, UInt_t nsa = 0);
+    void DisableWaveformProcessing() { fWaveProc = kFALSE; }
+    Bool_t WaveformProcessingEnabled() const { return fWaveProc; }
 
             
   private:
@@ -94,27 +103,53 @@ namespace Decoder {
       uint32_t peak_beyond_nsa, peak_not_found, peak_above_maxped;  // FADC pulse paramters
     } fadc_data;  // fadc_data_struct
 
-    struct fadc_pulse_data {
-      std::vector<uint32_t> integral, time, peak, pedestal;
-      std::vector<uint32_t> samples, coarse_time, fine_time;
-      std::vector<uint32_t> pedestal_quality, overflow, underflow;
-      void clear() {
-	integral.clear(); time.clear(); peak.clear(); pedestal.clear();
-	samples.clear(); coarse_time.clear(); fine_time.clear();
-	pedestal_quality.clear(); overflow.clear(); underflow.clear();
+    // Decoded pulse quantities. The first entries are in the same order
+    // as Decoder::EModuleType, so that either can index fPulse.
+    enum EPulseQty { kQSamples = kSampleADC, kQIntegral, kQTime, kQPeak,
+		     kQPedestal, kQCoarseTime, kQFineTime,
+		     kQPedestalQuality, kQOverflow, kQUnderflow, kNPulseQty };
+
+    // Values of one quantity for all channels, stored contiguously. Values
+    // are appended in decoding order; finalize() groups them by channel,
+    // after which the values of channel ch are data[offset[ch]..offset[ch+1]).
+    // Memory is kept across events.
+    struct PulseStore_t {
+      std::vector<uint32_t> data;      // Values
+      std::vector<uint8_t>  chan;      // Channel of each value (decoding order)
+      uint32_t offset[NADCCHAN+1];     // Start of each channel's values in data
+      void clear();
+      void finalize(std::vector<uint32_t>& work);
+      void push_back(uint32_t ch, uint32_t v) {
+	data.push_back(v); chan.push_back(static_cast<uint8_t>(ch));
       }
+      Int_t size(Int_t ch) const { return offset[ch+1]-offset[ch]; }
+      const uint32_t* begin(Int_t ch) const {
+	return data.empty() ? 0 : &data[0]+offset[ch];
+      }
+      uint32_t at(Int_t ch, Int_t i) const { return data[offset[ch]+i]; }
     };
-    std::vector<fadc_pulse_data> fPulseData; // Pulse data for each channel
+    PulseStore_t fPulse[kNPulseQty];   // Pulse data of all channels
+    std::vector<uint32_t> fWork;       // Scratch space for PulseStore_t::finalize
 
     Bool_t data_type_4, data_type_6, data_type_7, data_type_8, data_type_9, data_type_10;
     Bool_t block_header_found, block_trailer_found, event_header_found, slots_match;
     uint32_t data_type_def;
 
+    // Software pulse processing parameters
+    Bool_t fWaveProc;   // Process raw samples
+    UInt_t fTET;        // Threshold above pedestal
+    UInt_t fNPED;       // Number of samples for pedestal
+    UInt_t fNSB, fNSA;  // Samples before/after crossing (0: from block header)
+    Bool_t fEmptyWindowWarned; // Warned about NSB = NSA = 0
+
     void ClearDataVectors();
-    void PopulateDataVector(std::vector<uint32_t>& data_vector, uint32_t data);
-    Int_t SumVectorElements(const std::vector<uint32_t>& data_vector) const;
+    void FinishDataVectors();
+    void PopulateDataVector(EPulseQty qty, uint32_t data);
+    Int_t SumVectorElements(const uint32_t* begin, const uint32_t* end) const;
+    Int_t GetPulseValue(EPulseQty qty, Int_t chan, Int_t ievent, const char* here) const;
+    void ProcessWaveforms();
     void LoadTHaSlotDataObj(THaSlotData *sldat);
-    Int_t LoadThisBlock(THaSlotData *sldat, std::vector<UInt_t > evb);
+    Int_t LoadThisBlock(THaSlotData *sldat, const EvBuffer_t& evb);
     void PrintDataType() const;
 
     static TypeIter_t fgThisType;
@@ -17,7 +17,7 @@ class FastbusModule : public Module {
 
 public:
 
-   FastbusModule() : Module() {}
+   FastbusModule() : Module(), fSlotMask(0), fSlotShift(0) {}
    FastbusModule(Int_t crate, Int_t slot);
    virtual ~FastbusModule();
 
@@ -25,6 +25,7 @@ public:
 
    virtual Int_t Decode(const UInt_t *evbuffer);
    virtual Bool_t IsSlot(UInt_t rdata) { return (Slot(rdata)==fSlot); };
+   virtual void GetSlotSignature(UInt_t& header, UInt_t& mask) const;
    virtual Int_t LoadSlot(THaSlotData *sldat, const UInt_t* evbuffer, const UInt_t *pstop);
    void DoPrint() const;
 
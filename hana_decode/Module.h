@@ -88,6 +88,13 @@ namespace Decoder {
     virtual void Clear(const Option_t* = "") { fWordsSeen = 0; };
 
     virtual Bool_t IsSlot(UInt_t rdata);
+    // Header and mask such that IsSlot(rdata) implies (rdata&mask)==header.
+    // Lets the decoder find the candidate slots of a data word quickly.
+    virtual void GetSlotSignature(UInt_t& header, UInt_t& mask) const
+    {
+      header = fHeader;
+      mask   = fHeaderMask;
+    }
 
     virtual Int_t GetCrate() const { return fCrate; };
     virtual Int_t GetSlot()  const { return fSlot; };
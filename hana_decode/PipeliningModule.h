@@ -25,6 +25,10 @@
 //   the last event buffer will have the block trailer
 //   and all event buffers will have an event header
 //
+//   The event buffers are not copied. Each one is a span of words in
+//   the CODA event buffer, plus the block header word that precedes
+//   the block. They remain valid until the next CODA event is read.
+//
 /////////////////////////////////////////////////////////////////////
 
 #include "VmeModule.h"
@@ -44,17 +48,26 @@ public:
 
 protected:
 
-   Int_t SplitBuffer(std::vector< UInt_t > bigbuffer);
+   // Event buffer of one event: the block header word, if any, followed
+   // by the words in [begin,end)
+   struct EvBuffer_t {
+     const UInt_t* header;
+     const UInt_t* begin;
+     const UInt_t* end;
+     UInt_t size() const { return (header ? 1 : 0) + (end-begin); }
+   };
+
+   Int_t SplitBuffer(const UInt_t* evbuffer, const UInt_t* pstop);
    void ReStart();
-   std::vector< UInt_t >GetNextBlock();
+   const EvBuffer_t& GetNextBlock();
    Int_t LoadNextEvBuffer(THaSlotData *sldat)=0;
-   virtual Int_t LoadThisBlock(THaSlotData *sldat, std::vector<UInt_t > evb)=0;
+   virtual Int_t LoadThisBlock(THaSlotData *sldat, const EvBuffer_t& evb)=0;
    Int_t fNWarnings;
    UInt_t fBlockHeader;
 
    Bool_t fFirstTime;
 
-   std::vector< std::vector<  UInt_t > > eventblock;
+   std::vector< EvBuffer_t > eventblock;  //! Events in current CODA buffer
    UInt_t index_buffer;
    UInt_t GetIndex();
 
@@ -10,7 +10,7 @@ standalone = baseenv.subst('$STANDALONE')
 #print ('Compiling decoder executables:  STANDALONE = %s\n' % standalone)
 
 standalonelist = Split("""
-tstoo tstfadc tstf1tdc tstio tdecpr prfact epicsd tdecex tst1190
+tstoo tstfadc tstf1tdc tstio tdecpr prfact epicsd tdecex tst1190 tstmmap mkcodaidx tstrocdec
 """)
 # Still to come, perhaps, are (etclient, tstcoda) which should be compiled
 # if the ONLINE_ET variable is set.
@@ -37,10 +37,13 @@ SimDecoder.C
 THaCodaData.C
 THaCodaDecoder.C
 THaCodaFile.C
+THaCodaMmapFile.C THaCodaIndex.C
+THaCodaPrefetch.C
 THaCrateMap.C
 THaEpics.C
 THaEvData.C
 THaFastBusWord.C
+THaProfiler.C
 THaSlotData.C
 THaUsrstrutils.C
 VmeModule.C
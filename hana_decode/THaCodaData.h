@@ -60,6 +60,8 @@ protected:
    TString  filename;
    UInt_t*  evbuffer;     // Raw data
 
+   friend class THaCodaPrefetch;  // Reads directly into its ring buffers
+
    ClassDef(THaCodaData,0) // Base class of CODA data (file, ET conn, etc)
 
 };
@@ -47,6 +47,7 @@ private:
   THaCodaFile& operator=(const THaCodaFile &fn);
   void init(const char* fname="");
   void initFilter();
+  Bool_t passFilter(Int_t evtype, Int_t evnum) const;
   void staterr(const char* tried_to, Long64_t status);  // Can cause job to exit(0)
   Int_t ffirst;
   Int_t max_to_filt;
@@ -0,0 +1,85 @@
+#ifndef THaCodaIndex_h
+#define THaCodaIndex_h
+
+/////////////////////////////////////////////////////////////////////
+//
+//  THaCodaIndex
+//  Event index of a CODA file
+//
+//  Table of event number, event type, file position and length of
+//  every event in a CODA file.  The index is kept in a small sidecar
+//  file next to the data file, so that a data file needs to be scanned
+//  only once to allow random access to its events.
+//
+/////////////////////////////////////////////////////////////////////
+
+#include "Rtypes.h"
+#include "TString.h"
+#include <vector>
+
+namespace Decoder {
+
+class THaCodaIndex {
+
+public:
+
+  struct Entry {
+    UInt_t    evnum;   // Word 4 of event (event number of physics events)
+    UInt_t    evtype;  // Event type
+    UInt_t    length;  // Event length in words, including length word
+    UInt_t    unused;
+    ULong64_t block;   // File position of enclosing block header (words)
+    ULong64_t offset;  // File position of event (words)
+  };
+
+  THaCodaIndex();
+  virtual ~THaCodaIndex();
+
+  void         Add( const Entry& entry );
+  Int_t        Build( const char* codafile );
+  void         Clear();
+  Int_t        Load( const char* codafile, Bool_t build=kFALSE );
+  Int_t        Read( const char* idxfile, const char* codafile );
+  Int_t        Write( const char* idxfile=0 ) const;
+  void         Print() const;
+
+  Bool_t       IsValid()  const { return fValid; }
+  UInt_t       GetSize()  const { return fEntries.size(); }
+  const Entry& GetEntry( UInt_t i ) const { return fEntries[i]; }
+  const Entry& operator[]( UInt_t i ) const { return fEntries[i]; }
+  UInt_t       GetNphysics() const { return fPhysics.size(); }
+  UInt_t       GetTypeCount( UInt_t evtype ) const;
+  const char*  GetCodaFileName() const { return fCodaFile.Data(); }
+
+  // Index of the n-th physics event (n = 1, 2, ...), -1 if none
+  Long64_t     FindPhysics( UInt_t n ) const;
+  // Index of the first physics event with event number >= evnum, -1 if none
+  Long64_t     FindEvNum( UInt_t evnum ) const;
+
+  // Called by the file reader to start/finish recording an index
+  void         StartRecording( const char* codafile );
+  void         FinishRecording();
+
+  static TString GetIndexFileName( const char* codafile );
+
+private:
+
+  THaCodaIndex(const THaCodaIndex &fn);
+  THaCodaIndex& operator=(const THaCodaIndex &fn);
+  Int_t        GetFileInfo( const char* codafile );
+
+  std::vector<Entry>  fEntries;    //! Index entries, in file order
+  std::vector<UInt_t> fPhysics;    //! Indices of physics events in fEntries
+  std::vector<UInt_t> fTypeCount;  //! Number of events of each type
+  TString   fCodaFile;   // Name of indexed CODA file
+  ULong64_t fFileSize;   // Size of CODA file when indexed (bytes)
+  Long64_t  fFileTime;   // Modification time of CODA file when indexed
+  Bool_t    fValid;      // Index is complete and matches the CODA file
+
+  ClassDef(THaCodaIndex,0)   //  Event index of a CODA file
+
+};
+
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef THaCodaMmapFile_h
+#define THaCodaMmapFile_h
+
+/////////////////////////////////////////////////////////////////////
+//
+//  THaCodaMmapFile
+//  Memory-mapped file of CODA data
+//
+//  Read-only CODA data file that is memory-mapped instead of being
+//  read through the evio library. Events are handed out as pointers
+//  directly into the mapping, so there is usually no per-event copy
+//  and no limit on the event size.  Seek() gives random access to
+//  events listed in an event index (THaCodaIndex).
+//
+/////////////////////////////////////////////////////////////////////
+
+#include "THaCodaData.h"
+
+namespace Decoder {
+
+class THaCodaIndex;
+
+class THaCodaMmapFile : public THaCodaData {
+
+public:
+
+  THaCodaMmapFile();
+  THaCodaMmapFile(const char* filename);
+  ~THaCodaMmapFile();
+  Int_t codaOpen(const char* filename, Int_t mode=1);
+  Int_t codaOpen(const char* filename, const char* rw, Int_t mode=1);
+  Int_t codaClose();
+  Int_t codaRead();
+  virtual bool isOpen() const;
+  Int_t Seek(ULong64_t block, ULong64_t offset);
+  // Record event index while reading. Must be set before opening.
+  void  SetIndex(THaCodaIndex* index) { fIndex = index; }
+
+  Int_t     GetVersion() const { return fVersion; }
+  Bool_t    IsSwapped()  const { return fSwap; }
+  // Number of events that had to be copied (split across blocks)
+  ULong64_t GetNcopied() const { return fNcopied; }
+  // File position of last event read and of its block header (words)
+  ULong64_t GetEventOffset() const { return fEvOffset; }
+  ULong64_t GetBlockOffset() const { return fEvBlock; }
+
+private:
+
+  THaCodaMmapFile(const THaCodaMmapFile &fn);
+  THaCodaMmapFile& operator=(const THaCodaMmapFile &fn);
+  Int_t    NextBlock();
+  UInt_t*  GetScratch( ULong64_t nwords );
+
+  UInt_t*   fMap;        // Start of mapped file
+  ULong64_t fMapLen;     // Length of mapped file (words)
+  ULong64_t fNext;       // Offset of next block header (words)
+  ULong64_t fPos;        // Offset of next unread word in current block
+  ULong64_t fEnd;        // End of data in current block
+  ULong64_t fBlock;      // Offset of current block header
+  ULong64_t fEvBlock;    // Offset of block header of last event read
+  ULong64_t fEvOffset;   // Offset of last event read
+  UInt_t    fNblocks;    // Number of blocks visited
+  UInt_t    fBlockNum;   // Block number of current block
+  Int_t     fVersion;    // evio format version of file
+  Bool_t    fSwap;       // File has opposite byte order
+  Bool_t    fLastBlock;  // Current block is flagged as last block
+  Bool_t    fResync;     // Skip to the first event starting in next block
+  UInt_t*   fScratch;    // Buffer for events that need to be copied
+  ULong64_t fScratchLen; // Size of fScratch (words)
+  UInt_t*   fOwnBuffer;  // evbuffer allocated by THaCodaData
+  ULong64_t fNcopied;    // Number of events copied to fScratch
+  THaCodaIndex* fIndex;  // Event index to record (not owned)
+  Bool_t    fRecording;  // Recording fIndex
+
+  ClassDef(THaCodaMmapFile,0)   //  Memory-mapped file of CODA data
+
+};
+
+}
+
+#endif
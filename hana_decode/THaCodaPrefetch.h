@@ -0,0 +1,80 @@
+#ifndef THaCodaPrefetch_h
+#define THaCodaPrefetch_h
+
+/////////////////////////////////////////////////////////////////////
+//
+//   THaCodaPrefetch
+//   Read-ahead buffer for CODA data.
+//
+//   THaCodaPrefetch wraps another THaCodaData object (typically a
+//   THaCodaFile) and reads its events on a background thread into
+//   a ring of event buffers, so that file I/O overlaps with the
+//   analysis of the preceding events.  codaRead() simply takes the
+//   next ready buffer from the ring.
+//
+/////////////////////////////////////////////////////////////////////
+
+#include "THaCodaData.h"
+
+class TThread;
+class TMutex;
+class TCondition;
+
+namespace Decoder {
+
+class THaCodaPrefetch : public THaCodaData {
+
+public:
+
+   THaCodaPrefetch( THaCodaData* source, Int_t depth = 8 );
+   virtual ~THaCodaPrefetch();
+   virtual Int_t codaOpen(const char* file_name, Int_t mode=1);
+   virtual Int_t codaOpen(const char* file_name, const char* session, Int_t mode=1);
+   virtual Int_t codaClose();
+   virtual Int_t codaRead();
+   virtual Bool_t isOpen() const;
+
+   Int_t        GetDepth()      const { return fDepth; }
+   THaCodaData* GetSource()     const { return fSource; }
+   // Statistics of the most recent run
+   ULong64_t    GetNread()      const { return fNread; }
+   ULong64_t    GetNstalls()    const { return fNstalls; }
+   ULong64_t    GetNfull()      const { return fNfull; }
+   void         PrintStats()    const;
+
+private:
+
+   THaCodaPrefetch(const THaCodaPrefetch &fn);
+   THaCodaPrefetch& operator=(const THaCodaPrefetch &fn);
+
+   static void* ReaderThread( void* arg );
+   void   ReadLoop();
+   Int_t  StartReader();
+   void   StopReader();
+
+   THaCodaData* fSource;    // Data source (owned)
+   Int_t        fDepth;     // Number of buffers in the ring
+   UInt_t**     fRing;      // [fDepth] Event buffers
+   Int_t*       fStatus;    // [fDepth] codaRead() return code for each buffer
+   Int_t        fHead;      // Next buffer to be handed out
+   Int_t        fCount;     // Number of filled buffers, incl. the current one
+   Bool_t       fHaveCur;   // A buffer is currently handed out
+   Bool_t       fDone;      // Reader has hit EOF or a fatal error
+   Bool_t       fStop;      // Request to stop the reader
+   UInt_t*      fOwnBuffer; // Our evbuffer before it was pointed into the ring
+   UInt_t*      fSrcBuffer; // Source's own evbuffer
+   TThread*     fThread;    // Reader thread
+   TMutex*      fMutex;     // Protects the ring state
+   TCondition*  fNotEmpty;  // Signaled when a buffer has been filled
+   TCondition*  fNotFull;   // Signaled when a buffer has been released
+   ULong64_t    fNread;     // Events handed out
+   ULong64_t    fNstalls;   // Reads that had to wait for the reader thread
+   ULong64_t    fNfull;     // Times the reader had to wait for a free buffer
+
+   ClassDef(THaCodaPrefetch,0) // Read-ahead buffer for CODA data
+
+};
+
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <cstdio>
 #include "Rtypes.h"
 //#include "Decoder.h"
 
@@ -37,15 +38,16 @@ public:
   std::string GetTag() const    { return tag;    };
   std::string GetDate() const   { return dtime;  };
   Double_t GetTimeStamp() const { return timestamp; };
-  void MakeTime() {
+  void MakeTime() { timestamp = ParseTime(dtime); }
+  static Double_t ParseTime( const std::string& dt ) {
     // time is a continuous parameter.  funny things happen
     // at midnight or new month, but you'll figure it out.
     char t1[41],t2[41],t3[41],t4[41];
     int day, hour, min, sec;
-    sscanf(dtime.c_str(),"%40s %40s %6d %6d:%6d:%6d %40s %40s",
+    sscanf(dt.c_str(),"%40s %40s %6d %6d:%6d:%6d %40s %40s",
 	   t1,t2,&day,&hour,&min,&sec,t3,t4);
-    timestamp = 3600*24*day + 3600*hour + 60*min + sec;
-  }  
+    return 3600*24*day + 3600*hour + 60*min + sec;
+  }
   std::string GetString() const { return svalue; };
   std::string GetUnits() const  { return units;  };
     
@@ -73,11 +75,36 @@ public:
    Bool_t IsLoaded(const char* tag) const;
    void Print();
 
+// Access by tag ID. IDs remain valid for the lifetime of this object.
+   Int_t AddTag(const char* tag);         // ID of 'tag', created if new
+   Int_t FindTag(const char* tag) const;  // ID of 'tag', -1 if unknown
+   Bool_t IsLoaded(Int_t id) const;
+// Latest values of tags ids[0..n-1]. For tags without data, svalue[i] = 0.
+   Int_t GetLatest(UInt_t n, const Int_t* ids, Double_t* data,
+		   const char** svalue, Double_t* tstamp) const;
+
 private:
 
-   std::map< std::string, std::vector<EpicsChan> > epicsData;
-   std::vector<EpicsChan> GetChan(const char *tag) const;
-   Int_t FindEvent(const std::vector<EpicsChan>& ep, int event) const;
+   // History of one tag, sorted by event number
+   struct EpicsTag_t {
+     std::string              tag;
+     std::vector<Int_t>       evnum;
+     std::vector<Double_t>    dvalue;
+     std::vector<std::string> svalue;
+     std::vector<std::string> units;
+     std::vector<UInt_t>      date;   // Index into fDates
+   };
+   // Date strings and timestamps of the EPICS events read so far
+   struct EpicsDate_t {
+     std::string dtime;
+     Double_t    timestamp;
+   };
+
+   std::map< std::string, Int_t > fTagID;  //! Tag name -> index into fTags
+   std::vector<EpicsTag_t>  fTags;         //! Per-tag histories
+   std::vector<EpicsDate_t> fDates;        //! Dates of EPICS events
+
+   Int_t FindEvent(const EpicsTag_t& ep, int event) const;
 
    ClassDef(THaEpics,0)  // EPICS data 
 
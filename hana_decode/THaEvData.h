@@ -16,8 +16,9 @@
 #include "TBits.h"
 #include <cassert>
 #include <iostream>
+#include <vector>
 
-class THaBenchmark;
+class THaProfiler;
 
 class THaEvData : public TObject {
 
@@ -75,6 +76,8 @@ public:
   const UInt_t* GetRawDataBuffer(Int_t crate) const;
   Int_t     GetNumHits(Int_t crate, Int_t slot, Int_t chan) const;
   Int_t     GetData(Int_t crate, Int_t slot, Int_t chan, Int_t hit) const;
+  // All hits on a channel. Returns number of hits, sets pointer to data
+  Int_t     GetHits(Int_t crate, Int_t slot, Int_t chan, const Int_t*& data) const;
   Bool_t    InCrate(Int_t crate, Int_t i) const;
   // Num unique channels hit
   Int_t     GetNumChan(Int_t crate, Int_t slot) const;
@@ -82,6 +85,19 @@ public:
   Int_t     GetNextChan(Int_t crate, Int_t slot, Int_t index) const;
   const char* DevType(Int_t crate, Int_t slot) const;
 
+  // All hits on the channels lo..hi of a module, for detector decoding.
+  // Logical channel numbers start at 'first' at lo (at hi if 'reverse').
+  // Hits of a channel are consecutive, with hit = 0, 1, ...
+  struct ChanHit_t {
+    Int_t lchan;   // logical channel number
+    Int_t hit;     // hit number on this channel
+    Int_t data;    // data (as GetData)
+    Int_t raw;     // raw word (as GetRawData)
+  };
+  Int_t     GetModuleHits(Int_t crate, Int_t slot, Int_t lo, Int_t hi,
+			  Int_t first, Bool_t reverse,
+			  const ChanHit_t*& hits) const;
+
   Bool_t HasCapability( Decoder::EModuleType type, Int_t crate, Int_t slot ) const
   {
     Decoder::Module* module = GetModule(crate, slot);
@@ -170,13 +186,20 @@ public:
   virtual void PrintSlotData(Int_t crate, Int_t slot) const;
   virtual void PrintOut() const;
   virtual void SetRunTime( ULong64_t tloc );
+  void         SetRunInfo( Int_t num, Int_t type, ULong64_t tloc );
 
   // Status control
   void    EnableBenchmarks( Bool_t enable=true );
+  void    SetProfiler( THaProfiler* prof );
+  THaProfiler* GetProfiler() const { return fProfiler; }
   void    EnableHelicity( Bool_t enable=true );
   Bool_t  HelicityEnabled() const;
   void    EnableScalers( Bool_t enable=true );
   Bool_t  ScalersEnabled() const;
+  void    EnableLazyDecoding( Bool_t enable=true );
+  Bool_t  LazyDecodingEnabled() const;
+  void    RequireCrate( Int_t crate );
+  void    ClearRequiredCrates() { fRocRequired = 0; }
   void    SetOrigPS( Int_t event_type );
   TString GetOrigPS() const;
 
@@ -207,8 +230,14 @@ protected:
   enum {
     kHelicityEnabled = BIT(14),
     kScalersEnabled  = BIT(15),
+    kLazyDecoding    = BIT(16),
   };
 
+  // Profiler timers used by decoders
+  enum EProfKey { kProfClearEvent = 0, kProfPhysics, kProfRoc, kProfBank,
+		  kProfCtrlEvt, kProfEpics, kProfScaler, kProfFastbus,
+		  kProfVme, kNProfKeys };
+
   // static const Int_t MAXROC = 32;
   // static const Int_t MAXSLOT = 27;
 
@@ -260,13 +289,24 @@ protected:
   virtual void  makeidx(Int_t crate, Int_t slot);
   virtual void  FindUsedSlots();
 
+  // Lazy decoding. Derived classes that defer decoding of crates set the
+  // corresponding bits in fRocPending and implement DecodeCrate().
+  virtual Int_t DecodeCrate( Int_t /*crate*/ ) { return HED_OK; }
+  void          DecodePending( Int_t crate ) const;
+
+  UInt_t fRocRequired;         // Crates always decoded by LoadEvent (bits)
+  mutable UInt_t fRocPending;  // Crates of current event not yet decoded
+
   Int_t     fNSlotUsed;   // Number of elements of crateslot[] actually used
   Int_t     fNSlotClear;  // Number of elements of crateslot[] to clear
   UShort_t* fSlotUsed;    // [fNSlotUsed] Indices of crateslot[] used
   UShort_t* fSlotClear;   // [fNSlotClear] Indices of crateslot[] to clear
 
   Bool_t fDoBench;
-  THaBenchmark *fBench;
+  THaProfiler* fProfiler;       //! Profiler for decoder timing
+  Bool_t       fOwnProfiler;    //! fProfiler created by us
+  Int_t        fProfKey[kNProfKeys]; //! Keys of decoder timers
+  static const char* const fgProfKeyName[kNProfKeys];
 
   UInt_t fInstance;            // My instance
   static TBits fgInstances;    // Number of instances of this object
@@ -276,6 +316,7 @@ protected:
 
   static TString fgDefaultCrateMapName; // Default crate map name
   TString fCrateMapName; // Crate map database file name to use
+  mutable std::vector<ChanHit_t> fHitBuf; //! Buffer for GetModuleHits
   Bool_t fNeedInit;  // Crate map needs to be (re-)initialized
 
   Int_t  fDebug;     // Debug/verbosity level
@@ -313,6 +354,7 @@ inline Int_t THaEvData::GetRocLength(Int_t crate) const {
 
 inline Int_t THaEvData::GetNumHits(Int_t crate, Int_t slot, Int_t chan) const {
   // Number hits in crate, slot, channel
+  DecodePending(crate);
   assert( GoodCrateSlot(crate,slot) );
   if( crateslot[idx(crate,slot)] != 0 )
     return crateslot[idx(crate,slot)]->getNumHits(chan);
@@ -322,12 +364,26 @@ inline Int_t THaEvData::GetNumHits(Int_t crate, Int_t slot, Int_t chan) const {
 inline Int_t THaEvData::GetData(Int_t crate, Int_t slot, Int_t chan,
 				Int_t hit) const {
   // Return the data in crate, slot, channel #chan and hit# hit
+  DecodePending(crate);
   assert( GoodIndex(crate,slot) );
   return crateslot[idx(crate,slot)]->getData(chan,hit);
 };
 
+inline Int_t THaEvData::GetHits(Int_t crate, Int_t slot, Int_t chan,
+				const Int_t*& data) const {
+  // Data of all hits in crate, slot, channel #chan. The pointer is valid
+  // until the next event is loaded.
+  DecodePending(crate);
+  assert( GoodCrateSlot(crate,slot) );
+  data = 0;
+  if( crateslot[idx(crate,slot)] != 0 )
+    return crateslot[idx(crate,slot)]->getHits(chan,data);
+  return 0;
+};
+
 inline Int_t THaEvData::GetNumRaw(Int_t crate, Int_t slot) const {
   // Number of raw words in crate, slot
+  DecodePending(crate);
   assert( GoodCrateSlot(crate,slot) );
   if( crateslot[idx(crate,slot)] != 0 )
     return crateslot[idx(crate,slot)]->getNumRaw();
@@ -336,6 +392,7 @@ inline Int_t THaEvData::GetNumRaw(Int_t crate, Int_t slot) const {
 
 inline Int_t THaEvData::GetRawData(Int_t crate, Int_t slot, Int_t hit) const {
   // Raw words in crate, slot
+  DecodePending(crate);
   assert( GoodIndex(crate,slot) );
   return crateslot[idx(crate,slot)]->getRawData(hit);
 };
@@ -343,6 +400,7 @@ inline Int_t THaEvData::GetRawData(Int_t crate, Int_t slot, Int_t hit) const {
 inline Int_t THaEvData::GetRawData(Int_t crate, Int_t slot, Int_t chan,
 				   Int_t hit) const {
   // Return the Rawdata in crate, slot, channel #chan and hit# hit
+  DecodePending(crate);
   assert( GoodIndex(crate,slot) );
   return crateslot[idx(crate,slot)]->getRawData(chan,hit);
 };
@@ -380,6 +438,7 @@ inline Bool_t THaEvData::InCrate(Int_t crate, Int_t i) const {
 
 inline Int_t THaEvData::GetNumChan(Int_t crate, Int_t slot) const {
   // Get number of unique channels hit
+  DecodePending(crate);
   assert( GoodCrateSlot(crate,slot) );
   if( crateslot[idx(crate,slot)] != 0 )
     return crateslot[idx(crate,slot)]->getNumChan();
@@ -389,11 +448,23 @@ inline Int_t THaEvData::GetNumChan(Int_t crate, Int_t slot) const {
 inline Int_t THaEvData::GetNextChan(Int_t crate, Int_t slot,
 				    Int_t index) const {
   // Get list of unique channels hit (indexed by index=0,getNumChan()-1)
+  DecodePending(crate);
   assert( GoodIndex(crate,slot) );
   assert( index >= 0 && index < GetNumChan(crate,slot) );
   return crateslot[idx(crate,slot)]->getNextChan(index);
 };
 
+inline void THaEvData::DecodePending( Int_t crate ) const {
+  // Decode the given crate now if its decoding was deferred
+  if( fRocPending == 0 || crate < 0 || crate >= Decoder::MAXROC )
+    return;
+  UInt_t bit = 1U << crate;
+  if( (fRocPending & bit) == 0 )
+    return;
+  fRocPending &= ~bit;
+  const_cast<THaEvData*>(this)->DecodeCrate(crate);
+}
+
 inline
 Bool_t THaEvData::IsPhysicsTrigger() const {
   return ((event_type > 0) && (event_type <= Decoder::MAX_PHYS_EVTYPE));
@@ -443,6 +514,13 @@ Bool_t THaEvData::ScalersEnabled() const
   return TestBit(kScalersEnabled);
 }
 
+inline
+Bool_t THaEvData::LazyDecodingEnabled() const
+{
+  // Test if lazy decoding enabled
+  return TestBit(kLazyDecoding);
+}
+
 // Dummy versions of EPICS data access functions. These will always fail
 // in debug mode unless IsLoadedEpics is changed. This is by design -
 // clients should never try to retrieve data that are not loaded.
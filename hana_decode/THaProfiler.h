@@ -0,0 +1,178 @@
+#ifndef THaProfiler_h
+#define THaProfiler_h
+
+/////////////////////////////////////////////////////////////////////
+//
+//  THaProfiler
+//  Hierarchical timers for the event loop
+//
+//  Timers are identified by integer keys obtained from DefineKey()
+//  during initialization. Start(key)/Stop(key) pairs may be nested;
+//  each timer is accounted separately for every distinct path of
+//  enclosing timers, e.g. "Decode.R.vdc" and "CoarseTracking.R.vdc".
+//  For keys defined with per_event = kTRUE, the time spent per event
+//  (between calls to EndEvent()) is histogrammed.
+//
+//  Optionally, the per-event timers of a sample of events are written
+//  to a trace file in Chrome trace event (JSON) format, which can be
+//  viewed with chrome://tracing or Perfetto.
+//
+//
+/////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+#include "TString.h"
+#include <vector>
+#include <utility>
+#include <cstdio>
+#include <cassert>
+
+class TH1F;
+class TDirectory;
+
+class THaProfiler : public TObject {
+
+public:
+  THaProfiler();
+  virtual ~THaProfiler();
+
+  Int_t        DefineKey( const char* name, Bool_t per_event = kTRUE );
+  Int_t        GetKey( const char* name ) const;
+  const char*  GetKeyName( Int_t key ) const { return fKeys[key].name.Data(); }
+
+  void         Start( Int_t key );
+  void         Stop( Int_t key );
+  void         EndEvent();
+
+  Long64_t     GetNevents()  const { return fNevents; }
+  Double_t     GetTotal( Int_t key ) const;
+  virtual void Print( Option_t* opt="" ) const;
+  void         Reset();
+  Int_t        WriteHistograms( TDirectory* dir ) const;
+
+  // Event trace
+  Int_t        OpenTrace( const char* filename, UInt_t interval = 100,
+			  Double_t threshold = 0, Int_t pid = 0 );
+  void         CloseTrace();
+  Bool_t       IsTracing() const { return fTraceFile != 0; }
+  Bool_t       IsTraceWanted() const;
+  void         AddTraceArg( const char* name, Double_t value );
+  Long64_t     GetNtraced() const { return fNtraced; }
+
+  // Monotonic clock (ns)
+  static ULong64_t Now();
+
+protected:
+  struct Key_t {
+    TString   name;         // Timer name
+    Bool_t    per_event;    // Collect per-event statistics
+  };
+  struct Node_t {
+    Int_t     key;          // Timer key
+    Int_t     parent;       // Enclosing node (-1: top)
+    Bool_t    per_event;    // Collect per-event statistics
+    std::vector<Int_t> children; // Nodes started while this one was running
+    Long64_t  ncalls;       // Number of Start/Stop intervals
+    ULong64_t total;        // Total time (ns)
+    ULong64_t evtime;       // Time in current event (ns)
+    Bool_t    active;       // Started in current event
+    Long64_t  nevents;      // Number of events with this timer active
+    ULong64_t evmin;        // Minimum time per event (ns)
+    ULong64_t evmax;        // Maximum time per event (ns)
+    TH1F*     hist;         // Distribution of time per event (us)
+  };
+
+  std::vector<Key_t>     fKeys;      // Defined timer keys
+  std::vector<Node_t>    fNodes;     // Call tree. Node 0 is the root
+  std::vector<Int_t>     fStack;     // Running nodes, innermost last
+  std::vector<ULong64_t> fStartTime; // Start times of running nodes
+  std::vector<Int_t>     fActive;    // Nodes active in current event
+  std::vector<Double_t>  fBins;      // Histogram bin edges (us)
+  Long64_t               fNevents;   // Number of events ended
+
+  // Event trace
+  struct TraceRec_t {
+    Int_t     key;          // Timer key
+    ULong64_t start;        // Start time (ns)
+    ULong64_t stop;         // Stop time (ns)
+  };
+  FILE*                  fTraceFile;      // Trace output file (0: no trace)
+  UInt_t                 fTraceInterval;  // Write every n-th event
+  ULong64_t              fTraceThreshold; // Also write events longer than this (ns)
+  Int_t                  fTracePid;       // Process ID written to the trace
+  ULong64_t              fTraceT0;        // Time of OpenTrace (ns)
+  Long64_t               fTraceCount;     // Events seen since OpenTrace
+  Long64_t               fNtraced;        // Events written to the trace
+  Bool_t                 fTraceSampled;   // Current event is sampled
+  Bool_t                 fTraceRecord;    // Record timers of current event
+  std::vector<TraceRec_t> fTraceRec;      // Timers of current event
+  std::vector<std::pair<TString,Double_t> > fTraceArgs; // Event arguments
+
+  Int_t        AddNode( Int_t key, Int_t parent );
+  TString      GetPath( Int_t node, char sep = '.' ) const;
+  Double_t     GetQuantile( const Node_t& node, Double_t prob ) const;
+  void         PrintNode( Int_t node, Int_t depth ) const;
+  void         GetTraceSpan( ULong64_t& start, ULong64_t& stop ) const;
+  void         WriteTraceEvent();
+
+private:
+  THaProfiler( const THaProfiler& );
+  THaProfiler& operator=( const THaProfiler& );
+
+  ClassDef(THaProfiler,0)   // Hierarchical timers with per-event statistics
+};
+
+//---------------- inlines ------------------------------------------
+inline void THaProfiler::Start( Int_t key )
+{
+  // Start timer 'key' within the currently running timer
+
+  assert( key >= 0 && key < (Int_t)fKeys.size() );
+  Int_t cur = fStack.back(), node = -1;
+  const std::vector<Int_t>& ch = fNodes[cur].children;
+  for( std::vector<Int_t>::size_type i = 0; i < ch.size(); i++ ) {
+    if( fNodes[ch[i]].key == key ) {
+      node = ch[i];
+      break;
+    }
+  }
+  if( node < 0 )
+    node = AddNode( key, cur );
+  fStack.push_back( node );
+  fStartTime.push_back( Now() );
+}
+
+//___________________________________________________________________
+inline void THaProfiler::Stop( Int_t key )
+{
+  // Stop timer 'key'. Any timers started within it and still running
+  // are stopped as well. Does nothing if 'key' is not running.
+
+  ULong64_t now = Now();
+  Int_t depth = fStack.size()-1;
+  while( depth > 0 && fNodes[fStack[depth]].key != key )
+    --depth;
+  if( depth == 0 )
+    return;
+  while( (Int_t)fStack.size() > depth ) {
+    Node_t& node = fNodes[fStack.back()];
+    ULong64_t dt = now - fStartTime.back();
+    node.ncalls++;
+    node.total += dt;
+    if( node.per_event ) {
+      node.evtime += dt;
+      if( !node.active ) {
+	node.active = kTRUE;
+	fActive.push_back( fStack.back() );
+      }
+      if( fTraceRecord ) {
+	TraceRec_t rec = { node.key, fStartTime.back(), now };
+	fTraceRec.push_back( rec );
+      }
+    }
+    fStack.pop_back();
+    fStartTime.pop_back();
+  }
+}
+
+#endif
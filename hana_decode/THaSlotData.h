@@ -15,6 +15,11 @@
 //   hit counters are zero'd each event, not the data
 //   arrays, see below.
 //
+//   The hits are stored in the order they are loaded. On the first
+//   access by channel after loading, a copy of the data sorted by
+//   channel is made with a counting sort, so that all hits of a channel
+//   are contiguous. getHits() gives direct access to them.
+//
 //   author  Robert Michaels (rom@jlab.org)
 //
 /////////////////////////////////////////////////////////////////////
@@ -52,6 +57,11 @@ public:
        int getNumChan() const;              // Num unique channels hit
        int getNextChan(int index) const;    // List of unique channels hit
        int getData(int chan, int hit) const;  // Data (adc,tdc,scaler) on 1 chan
+       // All hits on a channel: returns number of hits, sets pointer to data
+       int getHits(int chan, const int*& dat) const;
+       int getRawHits(int chan, const int*& raw) const;
+       // Channels lo..hi with hits, in increasing order
+       int getChanRange(int lo, int hi, const UShort_t*& chans) const;
        int getCrate() const { return crate; }
        int getSlot()  const { return slot; }
        void clearEvent();                   // clear event counters
@@ -72,35 +82,33 @@ public:
 		   UShort_t ndata=DEFNDATA, UShort_t nhitperchan=DEFNHITCHAN );// Define crate, slot
        void print() const;
        void print_to_file() const;
-       int compressdataindex(int numidx);
 
 private:
 
+       void sortHits() const;
+       void growData();
 
        int crate;
        int slot;
        TString device;
        Module *fModule;
-       UShort_t numhitperchan; // expected number of hits per channel
        UInt_t numraw;      // Hit counters (numraw, numHits, numchanhit)
        UShort_t numchanhit;  // can be zero'd by clearEvent each event.
-       UShort_t firstfreedataidx;     // pointer to first free space in dataindex array
-       UShort_t numholesdataidx;
+       mutable bool sorted;  // chanData/chanRaw up to date
        UShort_t* numHits;     // numHits[channel]
-       Int_t *xnumHits;       // same as numHits
-       UShort_t* chanlist;   // chanlist[hitindex]
-       UShort_t* idxlist;    // [channel] pointer to 1st entry in dataindex
-       UShort_t* chanindex;  // [channel] gives hitindex
-       UShort_t* dataindex;  // [idxlist] pointer to rawdata and  data
-       UShort_t* numMaxHits;  // [channel] current maximum number of hits
+       UShort_t* chanlist;   // chanlist[hitindex], channels in order of 1st hit
+       UShort_t* hitchan;    // hitchan[hit] channel of each hit
+       mutable UInt_t* hitidx;  // [channel] index of 1st hit in chanData
+       mutable UShort_t* sortchan; // channels with hits, in increasing order
        int* rawData;         // rawData[hit] (all bits)
        int* data;            // data[hit] (only data bits)
+       mutable int* chanRaw;   // rawData grouped by channel
+       mutable int* chanData;  // data grouped by channel
        std::ofstream *fDebugFile; // debug output to this file, if nonzero
        bool didini;          // true if object initialized via define()
        UInt_t maxc;        // Number of channels for this device
        UInt_t maxd;          // Max number of data words per event
        UInt_t allocd;      // Allocated size of data arrays
-       UInt_t alloci;      // Allocated size of dataindex array
 
        ClassDef(THaSlotData,0)   //  Data in one slot of fastbus, vme, camac
 };
@@ -120,10 +128,8 @@ int THaSlotData::getRawData(int chan, int hit) const {
   assert( chan >= 0 && chan < (int)maxc && hit >= 0 &&  hit < numHits[chan] );
   if (chan < 0 || chan >= (int)maxc || numHits[chan]<=hit || hit<0 )
     return 0;
-  int index = dataindex[idxlist[chan]+hit];
-  assert(index >= 0 && index < (int)numraw);
-  if (index >= 0 && index < (int)numraw) return rawData[index];
-  return 0;
+  if (!sorted) sortHits();
+  return chanRaw[hitidx[chan]+hit];
 };
 
 //_____________________________________________________________________________
@@ -158,10 +164,34 @@ int THaSlotData::getData(int chan, int hit) const {
   assert( chan >= 0 && chan < (int)maxc && hit >= 0 &&  hit < numHits[chan] );
   if (chan < 0 || chan >= (int)maxc || numHits[chan]<=hit || hit<0 )
     return 0;
-  int index = dataindex[idxlist[chan]+hit];
-  assert(index >= 0 && index < (int)numraw);
-  if (index >= 0 && index < (int)numraw) return data[index];
-  return 0;
+  if (!sorted) sortHits();
+  return chanData[hitidx[chan]+hit];
+};
+
+//_____________________________________________________________________________
+// Data of all hits on 1 chan. The pointer is valid until the next event.
+inline
+int THaSlotData::getHits(int chan, const int*& dat) const {
+  assert( chan >= 0 && chan < (int)maxc );
+  dat = 0;
+  if (chan < 0 || chan >= (int)maxc || numHits[chan] == 0)
+    return 0;
+  if (!sorted) sortHits();
+  dat = chanData+hitidx[chan];
+  return numHits[chan];
+};
+
+//_____________________________________________________________________________
+// Raw words of all hits on 1 chan. The pointer is valid until the next event.
+inline
+int THaSlotData::getRawHits(int chan, const int*& raw) const {
+  assert( chan >= 0 && chan < (int)maxc );
+  raw = 0;
+  if (chan < 0 || chan >= (int)maxc || numHits[chan] == 0)
+    return 0;
+  if (!sorted) sortHits();
+  raw = chanRaw+hitidx[chan];
+  return numHits[chan];
 };
 
 //_____________________________________________________________________________
@@ -177,41 +207,10 @@ void THaSlotData::clearEvent() {
   // Only the minimum is cleared; e.g. data array is not cleared.
   // CAUTION: this code is critical for performance
   numraw = 0;
-  firstfreedataidx=0;
-  numholesdataidx=0;
+  sorted = true;
   while( numchanhit>0 ) numHits[chanlist[--numchanhit]] = 0;
 };
 
-//_____________________________________________________________________________
-inline
-int THaSlotData::compressdataindex(int numidx) {
-
-  // first check if it is more favourable to expand it, or to reshuffle
-  if (firstfreedataidx+numidx>=(int)alloci){
-    if (((numholesdataidx/alloci)>0.5)&&(numholesdataidx>numidx)) {
-      // reshuffle, lots of holes
-      UShort_t* tmp = new UShort_t[alloci];
-      firstfreedataidx=0;
-      for (UShort_t i=0; i<numchanhit; i++) {
-	UShort_t chan=chanlist[i];
-	for (UShort_t j=0; j<numHits[chan]; j++) {
-	  tmp[firstfreedataidx+j]=dataindex[idxlist[chan]+j];
-	}
-	firstfreedataidx=firstfreedataidx+numMaxHits[chan];
-      }
-      delete [] dataindex; dataindex=tmp;
-    } else {
-      UShort_t old_alloci = alloci;
-      alloci *= 2;
-      // FIX ME one should check that it doesnt grow too much
-      UShort_t* tmp = new UShort_t[alloci];
-      memcpy(tmp,dataindex,old_alloci*sizeof(UShort_t));
-      delete [] dataindex; dataindex = tmp;
-    }
-  }
-  return 0;
-};
-
 }
 
 #endif
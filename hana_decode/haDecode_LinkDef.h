@@ -27,6 +27,9 @@
 #pragma link C++ class Decoder::Caen792Module+;
 #pragma link C++ class Decoder::THaCodaData+;
 #pragma link C++ class Decoder::THaCodaFile+;
+#pragma link C++ class Decoder::THaCodaMmapFile+;
+#pragma link C++ class Decoder::THaCodaIndex+;
+#pragma link C++ class Decoder::THaCodaPrefetch+;
 #pragma link C++ class Decoder::THaCrateMap+;
 #pragma link C++ class Decoder::THaEpics+;
 #pragma link C++ class Decoder::THaFastBusWord+;
@@ -35,6 +38,7 @@
 #pragma link C++ class Decoder::THaCodaDecoder+;
 
 #pragma link C++ class THaBenchmark+;
+#pragma link C++ class THaProfiler+;
 #pragma link C++ class THaEvData+;
 #pragma link C++ class THaEvData::RocDat_t+;
 
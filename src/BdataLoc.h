@@ -60,6 +60,7 @@ public:
   virtual UInt_t  NumHits() const               { return DidLoad() ? 1 : 0; }
   virtual UInt_t  Get( Int_t i = 0 ) const      { assert(DidLoad()&&i==0); return data; }
   virtual void    Print( Option_t* opt="" ) const;
+  Int_t           GetCrate() const              { return crate; }
   //TODO: Needed?
   Bool_t operator==( const char* aname ) const  { return fName == aname; }
   // operator== and != compare the hardware definitions of two BdataLoc's
@@ -179,9 +180,42 @@ protected:
 private:
   static TypeIter_t fgThisType;
 
+  friend class MultiWordLoc;
+
   ClassDef(WordLoc,0)  
 };
 
+//___________________________________________________________________________
+class MultiWordLoc {
+  // Utility class used by THaDecData.
+  // Searches for the headers of several WordLoc's in the same crate
+  // in a single pass through the crate data.
+public:
+  explicit MultiWordLoc( Int_t cra )
+    : crate(cra), fEmpty(0), fShift(0), fMask(0) { }
+
+  void    Add( WordLoc* loc )
+  { assert(loc && loc->GetCrate() == crate); fLocs.push_back(loc); }
+  void    Init();
+  void    Load( const THaEvData& evt );
+  Int_t   GetCrate() const { return crate; }
+  UInt_t  GetSize()  const { return fLocs.size(); }
+
+protected:
+  Int_t                 crate;    // Crate number
+  std::vector<WordLoc*> fLocs;    // Header searches in this crate (not owned)
+  std::vector<Int_t>    fLocHdr;  // Index into fHeaders for each of fLocs
+  std::vector<UInt_t>   fHeaders; // Distinct header words
+  std::vector<Int_t>    fPos;     // Position of each header in current event
+  std::vector<UInt_t>   fTable;   // Open-addressing hash table of headers
+  std::vector<Int_t>    fTblHdr;  // Index into fHeaders for each fTable slot
+  UInt_t                fEmpty;   // Marker for empty fTable slots
+  UInt_t                fShift;   // Hash shift, 32 - log2(fTable size)
+  UInt_t                fMask;    // fTable size - 1
+
+  UInt_t  Hash( UInt_t w ) const { return (w * 2654435761U) >> fShift; }
+};
+
 //___________________________________________________________________________
 class RoclenLoc : public BdataLoc {
 public:
@@ -62,6 +62,7 @@
 //#pragma link C++ class THaOdata+;
 //#pragma link C++ class THaScalerKey+;
 #pragma link C++ class THaAnalyzer+;
+#pragma link C++ class THaOpticsReplay+;
 #pragma link C++ class THaPrintOption+;
 #pragma link C++ class THaBeam+;
 #pragma link C++ class THaBeamDet+;
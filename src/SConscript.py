@@ -38,6 +38,7 @@ THaRun.C                  THaTrack.C                THaVDCPlane.C
 THaCodaRun.C              THaFormula.C              THaParticleInfo.C
 THaRunBase.C              THaTrackEloss.C           THaVDCTimeToDistConv.C
 THaEvtTypeHandler.C       THaScalerEvtHandler.C     THaEvt125Handler.C
+THaOpticsReplay.C         THaParallel.C
 """)
 
 baseenv.Object('main.C')
@@ -72,6 +72,8 @@ public:
 			    const int debug_flag = 1);
   static Int_t    ReadDBline( FILE* fp, char* buf, size_t bufsiz,
 			      std::string& line );
+  static void     ClearDBCache();
+  static void     EnableDBCache( Bool_t b = kTRUE );
 
   // Access functions for reading tag/value pairs from database files
   static  Int_t   LoadDBvalue( FILE* file, const TDatime& date, 
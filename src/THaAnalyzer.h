@@ -9,6 +9,7 @@
 
 #include "TObject.h"
 #include "TString.h"
+#include <vector>
 
 class THaEvent;
 class THaRunBase;
@@ -18,11 +19,12 @@ class TIter;
 class TFile;
 class TDatime;
 class THaCut;
-class THaBenchmark;
+class THaProfiler;
 class THaEvData;
 class THaPostProcess;
 class THaCrateMap;
 class THaEpicsEvtHandler;
+class TCollection;
 
 class THaAnalyzer : public TObject {
 
@@ -36,10 +38,12 @@ public:
           Int_t  Init( THaRunBase& run )    { return Init( &run ); }
   virtual Int_t  Process( THaRunBase* run=NULL );
           Int_t  Process( THaRunBase& run ) { return Process(&run); }
+  virtual Int_t  ProcessSegments( const TCollection* runs );
   virtual void   Print( Option_t* opt="" ) const;
 
   void           EnableBenchmarks( Bool_t b = kTRUE );
   void           EnableHelicity( Bool_t b = kTRUE );
+  void           EnableLazyDecoding( Bool_t b = kTRUE );
   void           EnableOtherEvents( Bool_t b = kTRUE );
   void           EnableOverwrite( Bool_t b = kTRUE );
   void           EnablePhysicsEvents( Bool_t b = kTRUE );
@@ -50,6 +54,7 @@ public:
   const char*    GetCutFileName()      const  { return fCutFileName.Data(); }
   const char*    GetOdefFileName()     const  { return fOdefFileName.Data(); }
   const char*    GetSummaryFileName()  const  { return fSummaryFileName.Data(); }
+  const char*    GetTraceFileName()    const  { return fTraceFileName.Data(); }
   TFile*         GetOutFile()          const  { return fFile; }
   Int_t          GetCompressionLevel() const  { return fCompress; }
   THaEvent*      GetEvent()            const  { return fEvent; }
@@ -57,9 +62,13 @@ public:
   TList*         GetApps()             const  { return fApps; }
   TList*         GetPhysics()          const  { return fPhysics; }
   TList*         GetEvtHandlers()      const  { return fEvtHandlers; }
+  Int_t          GetNWorkers()         const  { return fNWorkers; }
+  UInt_t         GetChunkSize()        const  { return fChunkSize; }
   TList*         GetPostProcess()      const  { return fPostProcess; }
+  THaProfiler*   GetProfiler()         const  { return fProfiler; }
   Bool_t         HasStarted()          const  { return fAnalysisStarted; }
   Bool_t         HelicityEnabled()     const  { return fDoHelicity; }
+  Bool_t         LazyDecodingEnabled() const  { return fDoLazyDecode; }
   Bool_t         PhysicsEnabled()      const  { return fDoPhysics; }
   Bool_t         OtherEventsEnabled()  const  { return fDoOtherEvents; }
   Bool_t         SlowControlEnabled()  const  { return fDoSlowControl; }
@@ -70,9 +79,14 @@ public:
   void           SetCutFile( const char* name )  { fCutFileName = name; }
   void           SetOdefFile( const char* name ) { fOdefFileName = name; }
   void           SetSummaryFile( const char* name ) { fSummaryFileName = name; }
+  void           SetTraceFile( const char* name );
+  void           SetTraceInterval( UInt_t n )       { fTraceInterval = n; }
+  void           SetTraceThreshold( Double_t t )    { fTraceThreshold = t; }
   void           SetCompressionLevel( Int_t level ) { fCompress = level; }
   void           SetMarkInterval( UInt_t interval ) { fMarkInterval = interval; }
   void           SetVerbosity( Int_t level )        { fVerbose = level; }
+  void           SetNWorkers( Int_t n )             { fNWorkers = n; }
+  void           SetChunkSize( UInt_t n )           { fChunkSize = (n>0) ? n : 1; }
 
   // Set the EPICS event type
   void           SetEpicsEvtType(Int_t itype);
@@ -103,6 +117,13 @@ protected:
     kDecodeErr, kCodaErr, kRawDecodeTest, kDecodeTest, kCoarseTrackTest,
     kCoarseReconTest, kTrackTest, kReconstructTest, kPhysicsTest
   };
+  // Profiler timers
+  enum EProfKey {
+    kProfTotal = 0, kProfInit, kProfRawDecode, kProfDecode, kProfCoarseTrack,
+    kProfCoarseRecon, kProfTracking, kProfReconstruct, kProfPhysics,
+    kProfOutput, kProfCuts, kProfPostProcess, kProfMerge, kProfFinish,
+    kNProfKeys
+  };
   struct Counter_t {
     Int_t       key;
     const char* description;
@@ -119,6 +140,9 @@ protected:
   TString        fLoadedCutFileName;//Name of last loaded cut definition file
   TString        fOdefFileName;    //Name of output definition file
   TString        fSummaryFileName; //Name of test/cut statistics output file
+  TString        fTraceFileName;   //Name of event trace file (empty: no trace)
+  UInt_t         fTraceInterval;   //Trace every n-th event
+  Double_t       fTraceThreshold;  //Also trace events slower than this (us)
   THaEvent*      fEvent;           //The event structure to be written to file.
   Int_t          fNStages;         //Number of analysis stages
   Int_t          fNCounters;       //Number of counters
@@ -129,7 +153,10 @@ protected:
   Int_t          fCompress;        //Compression level for ROOT output file
   Int_t          fVerbose;         //Verbosity level
   Int_t          fCountMode;       //Event counting mode (see ECountMode)
-  THaBenchmark*  fBench;           //Counters for timing statistics
+  THaProfiler*   fProfiler;        //Timers for timing statistics
+  Int_t          fProfKey[kNProfKeys]; //Keys of the analyzer's timers
+  std::vector<Int_t> fAppKeys;     //Timer keys of apparatuses in fApps
+  std::vector<Int_t> fPhysKeys;    //Timer keys of physics modules in fPhysics
   THaEvent*      fPrevEvent;       //Event structure from last Init()
   THaRunBase*    fRun;             //Pointer to current run
   THaEvData*     fEvData;          //Instance of decoder used by us
@@ -138,6 +165,20 @@ protected:
   TList*         fPostProcess;     //List of post-processing modules
   TList*         fEvtHandlers;     //List of event handlers
 
+  // Parallel replay
+  Int_t          fNWorkers;        //Number of worker processes (<=1: serial)
+  UInt_t         fChunkSize;       //Physics events per worker work unit
+  Int_t          fWorker;          //Index of this worker (-1: not a worker)
+  UInt_t         fNPhysRead;       //Physics events read by this worker
+  Bool_t         fWorkerEvent;     //Current event is analyzed by this worker
+  Bool_t         fSkipDecode;      //Don't decode other workers' physics events
+  Bool_t         fEvDecoded;       //Current event was decoded
+  UInt_t         fRawEvNum;        //Event number from raw header if not decoded
+  std::vector<Long64_t> fChunkEntries; //Output tree size at end of each chunk
+  std::vector<Int_t>    fWorkerPid;    //Process IDs of worker processes
+  Bool_t         fSplitReplay;     //Workers replay segments of a split run
+  std::vector<THaRunBase*> fSegments; //Segments of split run being replayed
+
   // Status and control flags
   Bool_t         fIsInit;          // Init() called successfully
   Bool_t         fAnalysisStarted; // Process() run and output file open
@@ -149,6 +190,7 @@ protected:
   Bool_t         fDoPhysics;       // Enable physics event processing
   Bool_t         fDoOtherEvents;   // Enable other event processing
   Bool_t         fDoSlowControl;   // Enable slow control processing
+  Bool_t         fDoLazyDecode;    // Decode crates only when needed
 
   // Variables used by analysis functions
   Bool_t         fFirstPhysics;    // Status flag for physics analysis
@@ -173,7 +215,11 @@ protected:
   virtual bool   EvalStage( int n );
   virtual void   InitCounters();
   virtual void   InitCuts();
+  virtual void   InitRequiredCrates();
   virtual void   InitStages();
+  virtual void   InitProfiler();
+  virtual void   AddTraceArgs();
+  void           EndEventTiming();
   virtual Int_t  InitModules( TList* module_list, TDatime& time,
 			      Int_t erroff, const char* baseclass = NULL );
   virtual Int_t  InitOutput( const TList* module_list, Int_t erroff,
@@ -182,6 +228,17 @@ protected:
   virtual void   PrintScalers() const;  // archaic
   virtual void   PrintCutSummary() const;
 
+  // Parallel replay support
+  virtual Int_t  StartWorkers();
+  virtual Int_t  StartSegment( Int_t i );
+  virtual Int_t  WaitForSegments( bool& terminate, bool& fatal );
+  virtual Int_t  InitWorker();
+  virtual void   FinishWorker( Int_t code );
+  virtual Int_t  MergeWorkers( bool& terminate, bool& fatal );
+  Bool_t         IsWorkerEvent( Bool_t physics );
+  void           SyncEvent();
+  TString        GetWorkerFileName( Int_t i, const char* file = 0 ) const;
+
   static THaAnalyzer* fgAnalyzer;  //Pointer to instance of this class
 
   // In-class constants
@@ -12,6 +12,7 @@
 class THaDetector;
 class THaEvData;
 class TList;
+class THaProfiler;
 
 class THaApparatus : public THaAnalysisObject {
   
@@ -33,9 +34,11 @@ public:
   virtual Int_t        CoarseReconstruct() { return 0; }
   virtual Int_t        Reconstruct() = 0;
   virtual void         SetDebugAll( Int_t level );
+  virtual void         SetProfiler( THaProfiler* prof );
 
 protected:
   TList*         fDetectors;    // List of all detectors for this apparatus
+  THaProfiler*   fProfiler;     //! Profiler timing the detectors (0: none)
 
   THaApparatus( const char* name, const char* description );
   THaApparatus( );
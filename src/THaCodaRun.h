@@ -20,15 +20,20 @@ public:
   
   virtual Int_t        Close();
   virtual const UInt_t* GetEvBuffer() const;
+          Int_t        GetReadAhead() const { return fReadAhead; }
   virtual Bool_t       IsOpen() const;
+          void         PrintReadAheadStats() const;
   virtual Int_t        ReadEvent();
+          void         SetReadAhead( Int_t depth ) { fReadAhead = depth; }
 
 protected:
   static Int_t ReturnCode( Int_t coda_retcode);
+          void         SetupReadAhead();
 
   Decoder::THaCodaData*  fCodaData;  //! CODA data associated with this run
+  Int_t                  fReadAhead; //  Depth of read-ahead buffer (0=off)
 
-  ClassDef(THaCodaRun,1)    // ABC for a run based on CODA data
+  ClassDef(THaCodaRun,2)    // ABC for a run based on CODA data
 };
 
 
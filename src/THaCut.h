@@ -23,6 +23,8 @@ public:
 
   enum EvalMode { kModeErr = -1, kAND, kOR, kXOR };
 
+          void         AddStatistics( UInt_t ncalled, UInt_t npassed )
+    { fNCalled += ncalled; fNPassed += npassed; }
           void         ClearResult()        { fLastResult = kFALSE; }
   // Requires ROOT >= 4.00/00
   virtual Int_t        DefinedVariable( TString& variable, Int_t& action );
@@ -33,12 +35,16 @@ public:
           EvalMode     GetMode()      const { return fMode; }
           UInt_t       GetNCalled()   const { return fNCalled; }
           UInt_t       GetNPassed()   const { return fNPassed; }
-          Bool_t       GetResult()    const { return fLastResult; }
+          Bool_t       GetResult()    const
+    { return fLastResult && (!fGenerationP || fGeneration == *fGenerationP); }
   virtual Bool_t       IsArray()      const { return kFALSE; }
   virtual Bool_t       IsVarArray()   const { return kFALSE; }
   virtual void         Print( Option_t *opt="" ) const;
   virtual void         Reset();
   virtual void         SetBlockname( const Text_t* name );
+  // Results from generations other than *gen read as false (see THaCutList)
+          void         SetGenerationCounter( const UInt_t* gen )
+    { fGenerationP = gen; }
   virtual void         SetName( const Text_t* name );
   virtual void         SetNameTitle( const Text_t* name, const Text_t* title );
 
@@ -48,6 +54,8 @@ protected:
   UInt_t      fNCalled;     // Number of times this cut has been evaluated
   UInt_t      fNPassed;     // Number of times this cut was true when evaluated
   EvalMode    fMode;        // Evaluation mode of array expressions (AND/OR etc)
+  UInt_t      fGeneration;  //! Generation of fLastResult
+  const UInt_t* fGenerationP; //! Current generation of owning cut list
 
   Bool_t      EvalElement( Int_t instance );
   EvalMode    ParsePrefix( TString& expr );
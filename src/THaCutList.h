@@ -10,6 +10,8 @@
 #include "THashList.h"
 #include "THaCut.h"
 #include "THaNamedList.h"
+#include <vector>
+#include <map>
 
 class TList;
 class THaVarList;
@@ -54,6 +56,9 @@ public:
 			    const char* block=kDefaultBlockName );
   virtual Int_t     Eval();
   virtual Int_t     EvalBlock( const char* block=kDefaultBlockName );
+          Bool_t    EvalBlock( const TList* plist, const THaCut* master );
+          void      EnableShortCircuit( Bool_t b = kTRUE )
+    { fShortCircuit = b; }
   THaCut*           FindCut( const char* name ) const
     { return static_cast<THaCut*>(fCuts->FindObject( name )); }
   THaNamedList*     FindBlock( const char* block ) const
@@ -80,6 +85,20 @@ protected:
   THaHashList*      fBlocks;  //Hash list holding blocks of cuts.
                               //Elements of this table are THaNamedLists of THaCuts
   const THaVarList* fVarList; //Pointer to list of variables
+  UInt_t            fGeneration;   //Current generation of cut results
+  Bool_t            fShortCircuit; //Skip remaining cuts if master cut fails
+
+  // Block of cuts ordered for evaluation with a master cut
+  struct CutBlock_t {
+    std::vector<THaCut*> cuts;   // Master, its dependencies, then the rest
+    UInt_t               nfirst; // Number of cuts up to & including master
+    const THaCut*        master; // Master cut of the block (may be 0)
+    CutBlock_t() : nfirst(0), master(0) {}
+  };
+  std::map<const TList*,CutBlock_t> fBlockCache; //Compiled blocks
+
+  void              BuildBlock( const TList* plist, const THaCut* master,
+				CutBlock_t& blk ) const;
 
   static  void      MakePrintOption( THaPrintOption& opt, 
 				     const TList* plist );
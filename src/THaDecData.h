@@ -10,6 +10,7 @@
 #include "THaApparatus.h"
 #include "THashList.h"
 #include "BdataLoc.h"
+#include <vector>
 
 class TString;
 
@@ -34,11 +35,14 @@ protected:
   UInt_t          evtype;      // CODA event type
   UInt_t          evtypebits;  // Bitpattern of active trigger numbers
   THashList       fBdataLoc;   // Raw data channels
+  std::vector<MultiWordLoc> fWordLocGroups; //! Header searches grouped by crate
+  std::vector<BdataLoc*>    fLoadList;      //! Channels loaded individually
 
   virtual Int_t   DefineVariables( EMode mode = kDefine );
   virtual FILE*   OpenFile( const TDatime& date );
   virtual Int_t   ReadDatabase( const TDatime& date );
 
+  void            GroupWordLocs();
   Int_t           DefineLocType( const BdataLoc::BdataLocType& loctype,
 				 const TString& configstr, bool re_init );
 
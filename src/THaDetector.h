@@ -22,6 +22,8 @@ public:
   virtual ~THaDetector();
   THaApparatus*  GetApparatus() const;
   virtual void   SetApparatus( THaApparatus* );
+  Int_t          GetProfKey() const     { return fProfKey; }
+  void           SetProfKey( Int_t key ) { fProfKey = key; }
 
   THaDetector();  // for ROOT I/O only
 
@@ -35,6 +37,7 @@ protected:
 
 private:
   TRef  fApparatus;         // Apparatus containing this detector
+  Int_t fProfKey;           //! Key of profiler timer for this detector
 
   ClassDef(THaDetector,1)   //Abstract base class for a Hall A detector
 };
@@ -21,6 +21,7 @@ public:
   THaDetectorBase(); // only for ROOT I/O
 
   virtual Int_t    Decode( const THaEvData& ) = 0;
+  virtual Int_t    CountRawHits( const THaEvData& ) const;
 
   THaDetMap*       GetDetMap() const { return fDetMap; }
   Int_t            GetNelem()  const { return fNelem; }
@@ -9,6 +9,7 @@
 
 #include "THaPhysicsModule.h"
 #include "TString.h"
+#include <vector>
 
 class THaVertexModule;
 
@@ -18,17 +19,25 @@ public:
   virtual ~THaElossCorrection();
   
   virtual void      Clear( Option_t* opt="" );
+  virtual Int_t     End( THaRunBase* r=0 );
   virtual EStatus   Init( const TDatime& run_time );
 
   Double_t          GetMass()       const { return fM; }
   Double_t          GetEloss()      const { return fEloss; }
 
+          Double_t  ComputeEloss( Double_t p /* GeV/c */,
+				  Double_t pathlength /* m */ );
+          void      ComputeEloss( Int_t n, const Double_t* p,
+				  const Double_t* pathlength, Double_t* eloss );
+
           void      SetInputModule( const char* name );
           void      SetMass( Double_t m /* GeV/c^2 */ );
           void      SetTestMode( Bool_t enable=kTRUE,
 				 Double_t eloss_value=0.0 /* GeV */ );
           void      SetMedium( Double_t Z, Double_t A,
 			       Double_t density  /* g/cm^3 */ );
+          void      SetTableTolerance( Double_t tol );
+          void      SetValidationMode( Bool_t enable=kTRUE );
           void      SetPathlength( Double_t pathlength /* m */ );
           void      SetPathlength( const char* vertex_module,
 				   Double_t z_ref /* m */, Double_t scale = 1.0 );
@@ -46,6 +55,7 @@ protected:
 
   // Event-by-event data  
   Double_t           fEloss;       // Energy loss correction (GeV)
+  Double_t           fElossDev;    // Rel. deviation of table from analytic eloss
 
   // Parameters
   Double_t           fM;           // Mass of particle (GeV/c^2)
@@ -65,6 +75,19 @@ protected:
   TString            fVertexName;  // Name of vertex module for var pathlength, if any
   THaVertexModule*   fVertexModule;// Pointer to vertex module
 
+  // Energy loss per unit pathlength tabulated in log(beta*gamma)
+  std::vector<Double_t> fTable;    //! Energy loss for 1 m of medium (GeV)
+  Double_t           fTableUmin;   // log(beta*gamma) of first table point
+  Double_t           fTableUmax;   // log(beta*gamma) of last table point
+  Double_t           fTableInvH;   // 1/step size of table
+  Double_t           fTableTol;    // Max. rel. interpolation error (0: no table)
+  Bool_t             fValidate;    // Compare table lookups with analytic result
+  Double_t           fMaxElossDev; // Largest fElossDev seen in validation mode
+  Long64_t           fNValidated;  // Number of table lookups validated
+
+  Double_t      ElossAnalytic( Double_t p, Double_t pathlength ) const;
+  Int_t         MakeTable();
+
   // Setup functions
   virtual Int_t DefineVariables( EMode mode = kDefine );
   virtual Int_t ReadRunDatabase( const TDatime& date );
@@ -32,6 +32,10 @@ public:
    Double_t GetData(const char* tag, Int_t event=0) const;  
    Double_t GetTime(const char* tag, Int_t event=0) const; 
    TString GetString (const char* tag, int event=0) const;
+   // Fast access to the most recent values of a set of tags
+   Int_t GetTagID(const char* tag);
+   Int_t GetLatest(UInt_t n, const Int_t* ids, Double_t* data,
+		   const char** svalue, Double_t* tstamp) const;
 
 private:
 
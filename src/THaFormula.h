@@ -16,12 +16,14 @@
 #endif
 
 #include "THaGlobals.h"
+#include "VarType.h"
 #include <vector>
 #include <iostream>
 
 class THaVarList;
 class THaCutList;
 class THaVar;
+class THaCut;
 
 
 #if ROOT_VERSION_CODE < 394240
@@ -57,6 +59,7 @@ public:
   { return const_cast<THaFormula*>(this)->Eval(); }
   virtual Double_t    EvalInstance( Int_t instance );
   virtual Int_t       GetNdata()   const;
+          void        GetReferencedCuts( std::vector<const THaCut*>& cuts ) const;
   virtual Bool_t      IsArray()    const { return TestBit(kArrayFormula); }
   virtual Bool_t      IsVarArray() const { return TestBit(kVarArray); }
           Bool_t      IsError()    const { return TestBit(kError); }
@@ -101,7 +104,30 @@ protected:
   const THaCutList* fCutList;          //Pointer to list of cuts
   Int_t             fInstance;         //Current instance to evaluate
 
+  // Compiled form of the TFormula operator list, evaluated by EvalProgram()
+  struct FInstr_t {
+    Int_t         action;              //TFormula action code
+    Int_t         param;               //Action parameter
+    Double_t      value;               //Value of numerical constant
+    const char*   str;                 //Value of string constant
+  };
+  // Pre-bound access to the data of a variable referenced in the formula
+  struct FLoad_t {
+    const THaVar* var;                 //Variable, NULL: use DefinedValue()
+    VarType       type;                //Basic type of data elements
+    Int_t         index;               //Fixed index, -1: current instance
+  };
+  std::vector<FInstr_t>    fProgram;   //!Compiled program, empty if none
+  std::vector<FLoad_t>     fLoad;      //!Loaders for fVarDef
+  std::vector<Double_t>    fStack;     //!Evaluation stack
+  std::vector<Double_t>    fValues;    //!Values of variables
+  std::vector<const char*> fStrStack;  //!String stack
+  std::vector<char*>       fStrValues; //!Values of string variables
+
+          Bool_t    BuildProgram();
           Double_t  EvalInstanceUnchecked( Int_t instance );
+          Double_t  EvalProgram();
+          Double_t  LoadValue( Int_t i );
           Int_t     GetNdataUnchecked() const;
           Int_t     Init( const char* name, const char* expression );
   virtual Bool_t    IsString( Int_t oper ) const;
@@ -116,7 +142,9 @@ Double_t THaFormula::EvalInstanceUnchecked( Int_t instance )
 {
   fInstance = instance;
   if( fNoper == 1 && fVarDef.size() == 1 )
-    return DefinedValue(0);
+    return LoadValue(0);
+  else if( !fProgram.empty() )
+    return EvalProgram();
   else
     return EvalPar(0);
 }
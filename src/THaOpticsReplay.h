@@ -0,0 +1,111 @@
+#ifndef ROOT_THaOpticsReplay
+#define ROOT_THaOpticsReplay
+
+//////////////////////////////////////////////////////////////////////////
+//
+// THaOpticsReplay
+//
+// Re-run the target reconstruction on focal plane tracks from an
+// existing replay output file.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+#include "TString.h"
+#include <vector>
+
+class TFile;
+class TTree;
+class THaOutput;
+class THaEvData;
+class THaRunBase;
+class THaSpectrometer;
+class THaTrackingDetector;
+class TList;
+class TDatime;
+
+class THaOpticsReplay : public TObject {
+
+public:
+  THaOpticsReplay();
+  virtual ~THaOpticsReplay();
+
+  virtual Int_t    Init( const char* infile );
+  virtual Long64_t Process();
+  virtual void     Close();
+
+  const char*    GetInFileName()   const { return fInFileName.Data(); }
+  const char*    GetOutFileName()  const { return fOutFileName.Data(); }
+  const char*    GetOdefFileName() const { return fOdefFileName.Data(); }
+  Long64_t       GetNEntries()     const { return fNEntries; }
+  Int_t          GetNWorkers()     const { return fNWorkers; }
+  THaOutput*     GetOutput()       const { return fOutput; }
+
+  void           SetOutFile( const char* name )  { fOutFileName = name; }
+  void           SetOdefFile( const char* name ) { fOdefFileName = name; }
+  void           SetTreeName( const char* name ) { fTreeName = name; }
+  void           SetCompressionLevel( Int_t level ) { fCompress = level; }
+  void           SetNWorkers( Int_t n )          { fNWorkers = n; }
+  void           SetEventRange( Long64_t first, Long64_t last = -1 )
+  { fFirst = first; fLast = last; }
+  void           SetVerbosity( Int_t level )     { fVerbose = level; }
+
+protected:
+  // Track variables read from the input tree, "<prefix>tr.<name>"
+  enum { kX = 0, kY, kTh, kPh, kRX, kRY, kRTh, kRPh,
+	 kDX, kDY, kDTh, kDPh, kChi2, kNDoF, kNVAR };
+
+  // Input of one spectrometer
+  struct SpectInput_t {
+    THaSpectrometer*      spect;   // Spectrometer to reconstruct
+    THaTrackingDetector*  det;     // Creator of the replayed tracks
+    Int_t                 ntr;     // Number of tracks in current entry
+    Int_t                 maxtr;   // Maximum number of tracks per entry
+    UInt_t                found;   // Bit pattern of variables in the tree
+    std::vector<Double_t> buf;     // Variables, maxtr values per variable
+  };
+
+  TString        fInFileName;      // Replay output file with tracks
+  TString        fTreeName;        // Name of input tree
+  TString        fOutFileName;     // Name of output ROOT file
+  TString        fOdefFileName;    // Name of output definition file
+  Int_t          fCompress;        // Compression level for output file
+  Int_t          fNWorkers;        // Number of worker processes (<=1: serial)
+  Int_t          fWorker;          // Index of this worker (-1: not a worker)
+  Int_t          fVerbose;         // Verbosity level
+  Long64_t       fFirst;           // First entry to process
+  Long64_t       fLast;            // Last entry to process (-1: all)
+  Long64_t       fNEntries;        // Number of entries in input tree
+
+  TFile*         fInFile;          // Input file
+  TTree*         fInTree;          // Input tree
+  TFile*         fFile;            // Output file
+  THaOutput*     fOutput;          // Output tree and histograms
+  THaEvData*     fEvData;          // Empty decoder passed to physics modules
+  THaRunBase*    fRun;             // Run data from the input file
+  std::vector<SpectInput_t> fInput; // Input of each spectrometer
+  std::vector<Int_t> fWorkerPid;   // Process IDs of worker processes
+  Bool_t         fIsInit;          // Init() called successfully
+
+  virtual Int_t  InitModules( TList* module_list, const TDatime& date,
+			      const char* baseclass );
+  virtual Int_t  InitWorker();
+  virtual Int_t  OpenInput();
+  virtual void   CloseInput();
+  virtual Int_t  ProcessEntry( Long64_t entry );
+  virtual Long64_t ProcessRange( Long64_t first, Long64_t last,
+				Bool_t& fatal );
+  virtual Int_t  StartWorkers( Long64_t first, Long64_t last );
+  virtual Long64_t MergeWorkers();
+  TString        GetWorkerFileName( Int_t i ) const;
+
+  static const char* const kVarName[kNVAR];
+
+private:
+  THaOpticsReplay( const THaOpticsReplay& );
+  THaOpticsReplay& operator=( const THaOpticsReplay& );
+
+  ClassDef(THaOpticsReplay,0)  // Target reconstruction from stored tracks
+};
+
+#endif
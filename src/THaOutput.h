@@ -8,6 +8,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "Rtypes.h"
+#include "VarType.h"
 #include <vector>
 #include <map>
 #include <string> 
@@ -21,12 +22,17 @@ class THaVhist;
 class THaEvData;
 class TTree;
 class THaEvtTypeHandler;
+class THaProfiler;
 
 class THaOdata {
 // Utility class used by THaOutput to store arrays 
 // up to size 'nsize' for tree output.
+// The elements are of basic type 'type' (see VarType.h). Only arrays
+// of type kDouble can be filled element by element; arrays of other
+// types are filled in bulk with Copy().
 public:
-  THaOdata(int n=1) : tree(NULL), ndata(0), nsize(n)
+  THaOdata(int n=1, VarType t=kDouble) : tree(NULL), ndata(0), nsize(n),
+    type(t)
   { data = new Double_t[n]; }
   THaOdata(const THaOdata& other);
   THaOdata& operator=(const THaOdata& rhs);
@@ -47,16 +53,25 @@ public:
     return 1;
   }
   Int_t Fill(Double_t dat) { return Fill(0, dat); };
+  // Copy n elements of this array's type from 'array'
+  Int_t Copy(Int_t n, const void* array) {
+    if( n<=0 || (n>nsize && Resize(n-1)) ) return 0;
+    memcpy( data, array, n*GetElementSize());
+    ndata = n;
+    return 1;
+  }
   Double_t Get(Int_t index=0) {
-    if( index<0 || index>=ndata ) return 0;
+    if( index<0 || index>=ndata || type != kDouble ) return 0;
     return data[index];
   }
+  size_t GetElementSize() const;
     
   TTree*      tree;    // Tree that we belong to
   std::string name;    // Name of the tree branch for the data
   Int_t       ndata;   // Number of array elements
   Int_t       nsize;   // Maximum number of elements
-  Double_t*   data;    // [ndata] Array data
+  VarType     type;    // Type of array elements (kDouble ... kByte)
+  Double_t*   data;    // [ndata] Array data (storage for nsize elements)
 
 private:
 
@@ -81,10 +96,17 @@ public:
   virtual Bool_t TreeDefined() const { return fTree != 0; };
   virtual TTree* GetTree() const { return fTree; };
 
+  void SetProfiler( THaProfiler* prof );
+
   static void SetVerbosity( Int_t level );
   
 protected:
 
+  // Profiler timers
+  enum EProfKey { kProfInit = 0, kProfAttach, kProfEpics, kProfFormulas,
+		  kProfCuts, kProfVariables, kProfHistos, kProfTreeFill,
+		  kProfEnd, kNProfKeys };
+
   virtual Int_t LoadFile( const char* filename );
   virtual Int_t Attach();
   virtual Int_t FindKey(const std::string& key) const;
@@ -105,12 +127,20 @@ protected:
                            fCutnames, fCutdef,
                            fArrayNames, fVNames; 
   std::vector<THaVar* >  fVariables, fArrays;
+  std::vector<Int_t>     fVarType;  // Type of direct scalar branch, -1: fVar
   std::vector<THaVform* > fFormulas, fCuts;
   std::vector<THaVhist* > fHistos;
   std::vector<THaOdata* > fOdata;
   std::vector<THaEpicsKey*>  fEpicsKey;
+  // EPICS tag IDs and buffers for THaEpicsEvtHandler::GetLatest
+  THaEpicsEvtHandler*        fEpicsIDHandler;
+  std::vector<Int_t>         fEpicsID;
+  std::vector<Double_t>      fEpicsData, fEpicsTime;
+  std::vector<const char*>   fEpicsStr;
   TTree *fTree, *fEpicsTree; 
   bool fInit;
+  THaProfiler* fProfiler;             //! Profiler (0: no timing)
+  Int_t fProfKey[kNProfKeys];         //! Keys of timers
   
   enum EId {kVar = 1, kForm, kCut, kH1f, kH1d, kH2f, kH2d, kBlock,
             kBegin, kEnd, kRate, kCount };
@@ -0,0 +1,54 @@
+#ifndef ROOT_THaParallel
+#define ROOT_THaParallel
+
+//**********************************************************************
+//
+//       THaParallel.h  (interface)
+//
+// Helpers for replays that fork worker processes, each writing its
+// output to a temporary file that the master merges at the end.
+// Used by THaAnalyzer and THaOpticsReplay.
+//
+////////////////////////////////////////////////////////////////////////
+
+#include "Rtypes.h"
+#include "TString.h"
+#include <vector>
+
+class TFile;
+class TTree;
+class TH1;
+
+namespace THaParallel {
+  // name of the temporary output file of worker 'i' for output 'file',
+  // "out.root" -> "out_<tag>3.root"
+  TString WorkerFileName( const char* file, Int_t i,
+			  const char* tag = "worker" );
+
+  // fork a worker process, flushing pending output first. Returns
+  // 0 in the worker, the worker's pid in the master, < 0 on error
+  Int_t   Fork();
+
+  // kill and reap the processes in 'pids', then clear the list
+  void    KillWorkers( std::vector<Int_t>& pids );
+
+  // wait for worker 'pid' (-1: any). Returns the pid of the finished
+  // worker, < 0 on error. 'code' is its exit status, -1 if it crashed
+  Int_t   WaitWorker( Int_t pid, Int_t& code );
+
+  // create the worker's output file 'fname' and move all trees and
+  // histograms of the master's file 'master' there
+  TFile*  OpenWorkerFile( TFile* master, const char* fname, Int_t compress );
+
+  // terminate a worker process. Does not return
+  void    ExitWorker( Int_t code );
+
+  // append entries [first,last) of 'src' to 'dest' (last < 0: all)
+  void    CopyEntries( TTree* src, TTree* dest, Long64_t first = 0,
+		       Long64_t last = -1 );
+
+  // add the histograms of the same name from the workers' 'files'
+  void    AddHistograms( TH1* hist, const std::vector<TFile*>& files );
+}
+
+#endif
@@ -11,6 +11,10 @@
 #include "TString.h"
 #include <vector>
 
+namespace Decoder {
+  class THaCodaIndex;
+}
+
 class THaRun : public THaCodaRun {
 
 public:
@@ -25,21 +29,35 @@ public:
   virtual Int_t        Compare( const TObject* obj ) const;
           const char*  GetFilename() const { return fFilename.Data(); }
           Int_t        GetSegment()  const { return fSegment; }
+          Bool_t       IsIndexed()   const { return fUseIndex; }
+          Bool_t       IsMmap()      const { return fUseMmap; }
   virtual Int_t        Open();
   virtual void         Print( Option_t* opt="" ) const;
+  virtual Int_t        ReadEvent();
   virtual Int_t        SetFilename( const char* name );
+          void         SetIndexed( Bool_t b = kTRUE ) { fUseIndex = b; }
           void         SetNscan( UInt_t n );
+          void         SetMmap( Bool_t b = kTRUE ) { fUseMmap = b; }
+  virtual UInt_t       SkipToEvent( UInt_t first, Int_t mode );
 
 protected:
 
   TString       fFilename;     //  File name
   UInt_t        fMaxScan;      //  Max. no. of events to prescan (0=don't scan)
   Int_t         fSegment;      //  Segment number (for split runs)
+  Bool_t        fUseMmap;      //  Read file via memory mapping
+  Bool_t        fUseIndex;     //  Use event index file for random access
+
+  Decoder::THaCodaIndex* fIndex; //! Event index of the file
+  std::vector<UInt_t> fReadList; //! Index entries to read after SkipToEvent
+  UInt_t        fNextRead;     //! Next element of fReadList to read
+  Bool_t        fReadToEnd;    //! SkipToEvent went past the last event
+  Bool_t        fWriteIndex;   //! Save index recorded during reading
 
           Int_t FindSegmentNumber();
   virtual Int_t ReadInitInfo();
 
-  ClassDef(THaRun,6)           // A run based on a CODA data file on disk
+  ClassDef(THaRun,8)           // A run based on a CODA data file on disk
 };
 
 
@@ -68,8 +68,12 @@ public:
   virtual void         SetNumber( Int_t number );
           void         SetRunParamClass( const char* classname );
   virtual void         SetType( Int_t type );
+  virtual UInt_t       SkipToEvent( UInt_t first, Int_t mode );
   virtual Int_t        Update( const THaEvData* evdata );
 
+  // Interpretation of event number in SkipToEvent
+  enum ESkipMode { kSkipPhysics, kSkipAll, kSkipToEvNum };
+
   enum EInfoType { kDate      = BIT(0), 
 		   kRunNumber = BIT(1),
 		   kRunType   = BIT(2),
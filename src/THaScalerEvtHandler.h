@@ -45,7 +45,6 @@ private:
    std::vector<Decoder::GenScaler*> scalers;
    std::vector<ScalerLoc*> scalerloc;
    Double_t evcount;
-   UInt_t *rdata;
    Int_t fNormIdx, fNormSlot;
    Double_t *dvars;
    TTree *fScalerTree;
@@ -15,6 +15,7 @@
 #include "TRotation.h"
 #include "THaParticleInfo.h"
 #include "THaPidDetector.h"
+#include <vector>
 
 class THaTrack;
 class TList;
@@ -60,6 +61,16 @@ public:
           void             SetGoldenTrack( THaTrack* t ) { fGoldenTrack = t; }
           void             SetPID( Bool_t b = kTRUE )    { fPID = b; }
 
+  // Projections of all tracks onto the reference plane of a non-tracking
+  // detector, computed once per analysis stage by ProjectTracks()
+  struct TrackProj_t {
+    const THaSpectrometerDetector* det;   // Detector defining the plane
+    std::vector<Double_t> x, y;           // Intercept in detector coords (m)
+    std::vector<Double_t> pathl;          // Path length from reference plane (m)
+    std::vector<Int_t>    ok;             // Nonzero if track crosses the plane
+  };
+  const   TrackProj_t*     GetTrackProj( const THaSpectrometerDetector* det ) const;
+
   // The following is specific to small-acceptance pointing spectrometers
   // using spectrometer-specific coordinates such as TRANSPORT
   const   TRotation&       GetToLabRot() const { return fToLabRot; }
@@ -121,10 +132,16 @@ protected:
 
   UInt_t          fStagesDone;            //Bitfield of completed analysis stages
 
+  // Track projections shared by the non-tracking detectors
+  std::vector<TrackProj_t> fPlaneProj;    //! Projections, one per detector plane
+  std::vector<Double_t> fProjTrk;         //! Track origins and directions
+  UInt_t          fProjStage;             //! Stage of fPlaneProj (0: invalid)
+
   // only derived classes can construct me
   THaSpectrometer( const char* name, const char* description );
 
   virtual Int_t   ReadRunDatabase( const TDatime& date );
+  virtual void    ProjectTracks( UInt_t stage );
 
 private:
   Bool_t          fListInit;      //Detector lists initialized
@@ -15,14 +15,15 @@
 class THaTextvars {
 
 public:
-  THaTextvars() {}
+  THaTextvars() : fGeneration(0) {}
   virtual ~THaTextvars() {}
 
   Int_t    Add( const std::string& name, const std::string& value );
   Int_t    AddVerbatim( const std::string& name, const std::string& value );
-  void     Clear() { fVars.clear(); }
+  void     Clear() { fVars.clear(); ++fGeneration; }
   void     Print( Option_t* opt="" ) const;
-  void     Remove( const std::string& name ) { fVars.erase(name); }
+  void     Remove( const std::string& name )
+  { fVars.erase(name); ++fGeneration; }
   UInt_t   Size() const { return fVars.size(); }
 
   const char*               Get( const std::string& name, Int_t idx=0 ) const;
@@ -30,6 +31,8 @@ public:
   UInt_t                    GetArray( const std::string& name,
 				      std::vector<std::string>& array );
   UInt_t                    GetNvalues( const std::string& name ) const;
+  // Incremented whenever any variable changes
+  UInt_t                    GetGeneration() const { return fGeneration; }
 
   Int_t    Set( const std::string& name, const std::string& value ) {
     return Add(name,value);
@@ -45,6 +48,7 @@ private:
   Int_t Substitute( std::vector<std::string>& lines, bool do_multi ) const;
   
   Textvars_t fVars;
+  UInt_t     fGeneration;  // Change counter
 
   ClassDef(THaTextvars,0)
 };
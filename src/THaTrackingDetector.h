@@ -38,6 +38,8 @@ protected:
   THaTrackingDetector( const char* name, const char* description,
 		       THaApparatus* a = NULL );
 
+  friend class THaOpticsReplay;  // Replays stored tracks via AddTrack
+
   ClassDef(THaTrackingDetector,1)   //ABC for a generic tracking detector
 };
 
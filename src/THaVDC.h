@@ -15,6 +15,7 @@ class THaVDCChamber;
 class THaTrack;
 class TClonesArray;
 class THaVDCPoint;
+class THaVDCPointPair;
 
 class THaVDC : public THaTrackingDetector {
 
@@ -26,6 +27,7 @@ public:
 
   virtual void  Clear( Option_t* opt="" );
   virtual Int_t Decode( const THaEvData& );
+  virtual Int_t CountRawHits( const THaEvData& ) const;
   virtual Int_t CoarseTrack( TClonesArray& tracks );
   virtual Int_t FineTrack( TClonesArray& tracks );
   virtual Int_t FindVertices( TClonesArray& tracks );
@@ -41,6 +43,14 @@ public:
 
   void Print(const Option_t* opt) const;
 
+  // Reconstruct target quantities of n tracks from their focal plane
+  // coordinates in one pass through the optics tables. Outputs may be NULL.
+  void FocalPlaneToTarget( Int_t n, const Double_t* x_fp,
+			   const Double_t* th_fp, const Double_t* y_fp,
+			   const Double_t* ph_fp, Double_t* dp,
+			   Double_t* theta, Double_t* y, Double_t* phi,
+			   Double_t* pathl ) const;
+
   // Bits & and bit masks for THaTrack
   enum {
     kStageMask     = BIT(14) | BIT(15),  // Track processing stage bits
@@ -86,6 +96,27 @@ public:
     std::vector<double> poly;// the associated polynomial
   };
 
+  // Matrix elements of one target quantity, flattened for evaluation
+  // over many tracks at once. Element k is the polynomial in x_fp with
+  // coefficients coef[k*kPORDER+i], times the product of the powers of
+  // the focal plane variables with exponents pw[k*kNCOL+j] (see EPowCol).
+  enum EPowCol { kPowX, kPowTh, kPowY, kPowPh, kPowAbsTh, kNCOL };
+  enum { kNPOW = 10 };   // Exponents are single digits
+  class OpticsTable {
+  public:
+    OpticsTable() : n(0) {}
+    void  Clear() { n = 0; order.clear(); pw.clear(); coef.clear(); }
+    void  Add( const std::vector<THaMatrixElement>& matrix,
+	       const Int_t* col, bool fold_x = false );
+    void  Eval( Int_t ntr, const Double_t* x, const Double_t* pows,
+		Double_t* work, Double_t* result ) const;
+
+    Int_t                 n;      // Number of elements
+    std::vector<Int_t>    order;  // Polynomial order of each element
+    std::vector<Int_t>    pw;     // Exponents, kNCOL per element
+    std::vector<Double_t> coef;   // Coefficients, kPORDER per element
+  };
+
 protected:
 
   enum ECoordType { kTransport, kRotatingTransport };
@@ -95,6 +126,7 @@ protected:
   THaVDCChamber* fUpper;    // Upper chamber
 
   TClonesArray*  fLUpairs;  // Candidate pairs of lower/upper points
+  std::vector<THaVDCPointPair*> fPairOrder; //! fLUpairs by ascending error
 
   Double_t fVDCAngle;       // Angle from the VDC cs to TRANSPORT cs (rad)
   Double_t fSin_vdc;        // Sine of VDC angle
@@ -126,6 +158,22 @@ protected:
 
   std::vector<THaMatrixElement> fLMatrixElems;   // Path-length corrections (meters)
 
+  // Target matrix elements compiled in ReadDatabase
+  OpticsTable fDTable;      // delta
+  OpticsTable fTTable;      // theta
+  OpticsTable fYTable;      // y, including YTA elements
+  OpticsTable fPTable;      // phi, including PTA elements
+  OpticsTable fLTable;      // path length
+
+  std::vector<Double_t> fTrkBuf;         //! Focal plane/target coordinates
+  mutable std::vector<Double_t> fOptWork;//! Powers and work space for optics
+
+  void CompileOptics();
+  void GetFocalPlaneCoords( const THaTrack* track, Double_t& x, Double_t& th,
+			    Double_t& y, Double_t& ph ) const;
+  void SetTargetCoords( THaTrack* track, Double_t dp, Double_t theta,
+			Double_t y, Double_t phi, Double_t pathl );
+
   void CalcFocalPlaneCoords( THaTrack* track );
   void CalcTargetCoords(THaTrack *the_track );
   void CalcMatrix(const double x, std::vector<THaMatrixElement> &matrix);
@@ -133,10 +181,6 @@ protected:
   Double_t PolyInv(const double x1, const double x2, const double xacc,
 		 const double y, const int norder,
 		 const std::vector<double> &a);
-  Double_t CalcTargetVar(const std::vector<THaMatrixElement> &matrix,
-			 const double powers[][5]);
-  Double_t CalcTarget2FPLen(const std::vector<THaMatrixElement>& matrix,
-			    const Double_t powers[][5]);
   Int_t ReadDatabase( const TDatime& date );
 
   virtual Int_t ConstructTracks( TClonesArray* tracks = NULL, Int_t flag = 0 );
@@ -13,6 +13,7 @@
 #include "TClonesArray.h"
 #include "THaVDCHit.h"
 #include <cassert>
+#include <vector>
 
 namespace VDC {
   class TimeToDistConv;
@@ -117,6 +118,28 @@ protected:
 
   THaTriggerTime* fglTrg; //! time-offset global variable. Needed at the decode stage
 
+  // Per-event workspace. Kept between events so that the hit, cluster
+  // and cluster hit containers only need to grow, never reallocate.
+  struct HitData_t {
+    THaVDCWire* wire;
+    Int_t       wirenum;
+    Int_t       rawtime;
+    Double_t    time;
+    HitData_t( THaVDCWire* w, Int_t raw, Double_t t )
+      : wire(w), wirenum(w->GetNum()), rawtime(raw), time(t) {}
+    // Same ordering as THaVDCHit::ByWireThenTime
+    bool operator<( const HitData_t& rhs ) const {
+      if( wirenum != rhs.wirenum )
+	return ( wirenum < rhs.wirenum );
+      return ( time < rhs.time );
+    }
+  };
+  std::vector<HitData_t> fHitBuf;   //! Decoded hits, before sorting
+  VDC::Vhit_t   fClusHits;          //! Hits of current cluster candidate
+  Int_t         fNClustObj;         //! Cluster objects constructed in fClusters
+
+  THaVDCCluster* NewCluster( Int_t i );
+
   virtual void  MakePrefix();
   virtual Int_t ReadDatabase( const TDatime& date );
   virtual Int_t DefineVariables( EMode mode = kDefine );
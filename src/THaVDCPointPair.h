@@ -9,6 +9,7 @@
 
 #include "TObject.h"
 #include "THaVDCCluster.h"   // for chi2_t
+#include <functional>
 
 class THaVDCPoint;
 class THaTrack;
@@ -46,6 +47,17 @@ public:
 					THaVDCPoint* there,
 					Double_t spacing );
 
+  // Functor for sorting pairs by ascending matching error, equivalent to
+  // Compare(), but without the virtual call and type check
+  struct ByError :
+    public std::binary_function< THaVDCPointPair*, THaVDCPointPair*, bool >
+  {
+    bool operator() ( const THaVDCPointPair* a, const THaVDCPointPair* b ) const
+    {
+      return ( a->GetError() < b->GetError() );
+    }
+  };
+
 protected:
 
   THaVDCPoint*    fLowerPoint;  // Lower UV point
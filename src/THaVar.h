@@ -125,6 +125,8 @@ public:
 
   Double_t        GetValue( Int_t i = 0 )  const { return GetValueAsDouble(i); }
   const void*     GetValuePointer()        const { return fValueP; }
+  const void*     GetDataPointer()         const;
+  VarType         GetDataType()            const;
 
   virtual ULong_t Hash() const { return fParsedName.Hash(); }
   virtual Bool_t  HasSameSize( const THaVar& rhs ) const;
@@ -137,6 +139,10 @@ public:
     { return ( IsVarArray() || fParsedName.IsArray() ); }
   Bool_t          IsBasic() const
     { return ( fOffset == -1 && fMethod == 0 ); }
+  Bool_t          IsContiguous() const
+    { return ( IsBasic() && ((fType>=kDouble && fType<=kByte) ||
+			     (fType>=kDoubleP && fType<=kByteP) ||
+			     IsVector()) ); }
   Bool_t          IsPointerArray() const
     { return ( IsArray() && fType>=kDouble2P && fType <= kObject2P ); }
   Bool_t          IsVector() const
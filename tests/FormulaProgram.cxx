@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+//                                                                           //
+// FormulaProgram - Compare THaFormula's compiled program with               //
+//                  TFormula::EvalPar                                        //
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FormulaProgram.h"
+#include "THaFormula.h"
+#include "THaGlobals.h"
+#include "TString.h"
+#include "TMath.h"
+
+using namespace std;
+
+static RVarDef vars[] = {
+  { "a",    "Operand a", "fA" },
+  { "b",    "Operand b", "fB" },
+  { "zero", "Zero",      "fZero" },
+  { 0 }
+};
+
+// Expressions with &&/|| whose operands are neither 0 nor 1, so that a
+// short-circuited operator must still yield a boolean result.
+// "%s" is replaced with the variable prefix.
+static const char* const exprs[] = {
+  "(%sa||%sb)*3",
+  "(%sa&&%szero)*3",
+  "(%szero&&%sa)*3+%sb",
+  "(%sa||%szero)+(%szero||%sb)",
+  "(%sa&&%sb)*(%sb||%sa)*7",
+  "((%sa||%sb)&&(%szero||%sa))-2",
+  0
+};
+
+//_____________________________________________________________________________
+class FormulaTester : public THaFormula {
+  // Gives access to both evaluation methods of THaFormula
+public:
+  FormulaTester( const char* name, const char* expr )
+    : THaFormula(name,expr,kFALSE) {}
+  Bool_t   HasProgram() const { return !fProgram.empty(); }
+  Double_t Program()   { fInstance = 0; return EvalProgram(); }
+  Double_t Reference() { fInstance = 0; return EvalPar(0); }
+};
+
+namespace Podd {
+namespace Tests {
+
+//_____________________________________________________________________________
+FormulaProgram::FormulaProgram( const char* name, const char* description ) :
+  UnitTest(name,description), fA(kBig), fB(kBig), fZero(kBig)
+{
+  // Constructor
+}
+
+//_____________________________________________________________________________
+FormulaProgram::~FormulaProgram()
+{
+  // Destructor. Remove variables from global list.
+
+  RemoveVariables();
+}
+
+//_____________________________________________________________________________
+Int_t FormulaProgram::DefineVariables( EMode mode )
+{
+  // Define (or delete) global variables
+
+  if( mode == kDefine && fIsSetup ) return kOK;
+  fIsSetup = ( mode == kDefine );
+
+  return DefineVarsFromList( vars, mode );
+}
+
+//_____________________________________________________________________________
+Int_t FormulaProgram::ReadDatabase( const TDatime& date )
+{
+  // Initialize test parameters
+
+  fA = 5.0;
+  fB = -2.5;
+  fZero = 0.0;
+
+  fIsInit = true;
+  return kOK;
+}
+
+//_____________________________________________________________________________
+Int_t FormulaProgram::Test()
+{
+  // Evaluate each test expression with the compiled program and with
+  // TFormula::EvalPar. The results must be identical.
+
+  const char* const here = "Test";
+
+  if( !fIsInit || !fIsSetup || !IsOK() ) {
+    Error( Here(here), "Not initialized. Call Init() first." );
+    return -1;
+  }
+
+  const char* prefix = GetPrefix();
+  Int_t ret = 0, n = 0;
+  for( const char* const* e = exprs; *e; ++e, ++n ) {
+    TString expr = *e;
+    expr.ReplaceAll( "%s", prefix );
+    FormulaTester f( Form("fp%d",n), expr );
+    if( f.IsError() ) {
+      Error( Here(here), "Cannot compile %s", expr.Data() );
+      return 1;
+    }
+    if( !f.HasProgram() ) {
+      Error( Here(here), "No program built for %s", expr.Data() );
+      return 2;
+    }
+    Double_t val = f.Program(), expect = f.Reference();
+    if( fDebug > 0 )
+      Info( Here(here), "%s = %g (expected %g)", expr.Data(), val, expect );
+    if( val != expect ) {
+      Error( Here(here), "%s evaluates to %g, expected %g",
+	     expr.Data(), val, expect );
+      ret = 3;
+    }
+  }
+  return ret;
+}
+
+} // namespace Tests
+} // namespace Podd
+
+////////////////////////////////////////////////////////////////////////////////
+
+ClassImp(Podd::Tests::FormulaProgram)
@@ -0,0 +1,42 @@
+#ifndef Podd_Tests_FormulaProgram
+#define Podd_Tests_FormulaProgram
+
+///////////////////////////////////////////////////////////////////////////////
+//                                                                           //
+// FormulaProgram unit test                                                  //
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#include "UnitTest.h"
+
+namespace Podd {
+namespace Tests {
+
+class FormulaProgram : public UnitTest {
+
+public:
+  FormulaProgram( const char* name = "formula_program",
+		  const char* description = "Formula program unit test" );
+  virtual ~FormulaProgram();
+
+  virtual Int_t Test();
+
+protected:
+
+  // Test data
+  Double_t   fA;                // Operand values not equal to 0 or 1
+  Double_t   fB;
+  Double_t   fZero;
+
+  virtual Int_t  DefineVariables( EMode mode );
+  virtual Int_t  ReadDatabase( const TDatime& date );
+
+  ClassDef(FormulaProgram,0)   // Compiled formula vs. TFormula::EvalPar
+};
+
+} // namespace Tests
+} // namespace Podd
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif
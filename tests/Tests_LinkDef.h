@@ -6,5 +6,8 @@
 
 #pragma link C++ class Podd::Tests::UnitTest+;
 #pragma link C++ class Podd::Tests::ArrayRTTI+;
+#pragma link C++ class Podd::Tests::FormulaProgram+;
+#pragma link C++ class Podd::Tests::VDCOptics+;
+#pragma link C++ class Podd::Tests::WordLocSearch+;
 
 #endif
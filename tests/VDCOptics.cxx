@@ -0,0 +1,270 @@
+///////////////////////////////////////////////////////////////////////////////
+//                                                                           //
+// VDCOptics - Compare THaVDC::FocalPlaneToTarget with the per-element       //
+//             evaluation of the target matrix elements                      //
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#include "VDCOptics.h"
+#include "THaVDC.h"
+#include "TMath.h"
+#include <cmath>
+
+using namespace std;
+
+typedef THaVDC::THaMatrixElement ME_t;
+
+//_____________________________________________________________________________
+static ME_t MakeElement( Int_t np, const Int_t* pw, Int_t order,
+			 const Double_t* poly )
+{
+  // Matrix element with exponents pw[0..np-1] and polynomial coefficients
+  // poly[0..order-1], as read by THaVDC::ReadDatabase
+
+  ME_t me;
+  me.iszero = false;
+  me.pw.assign( pw, pw+np );
+  me.order = order;
+  me.poly.assign( poly, poly+order );
+  return me;
+}
+
+//_____________________________________________________________________________
+class VDCOpticsTester : public THaVDC {
+  // Gives access to the optics tables of THaVDC and evaluates the matrix
+  // elements one by one, the way THaVDC::CalcTargetCoords did before the
+  // optics tables were introduced
+public:
+  VDCOpticsTester() : THaVDC("vdc","Optics test VDC") {}
+  void Setup();
+  void Reference( Double_t x_fp, Double_t th_fp, Double_t y_fp,
+		  Double_t ph_fp, Double_t* result );
+private:
+  Double_t CalcTargetVar( const vector<ME_t>& matrix,
+			  const Double_t powers[][5] );
+  Double_t CalcTarget2FPLen( const vector<ME_t>& matrix,
+			     const Double_t powers[][5] );
+};
+
+//_____________________________________________________________________________
+void VDCOpticsTester::Setup()
+{
+  // Define a small set of matrix elements of each kind and compile them
+
+  // Standard elements: exponents of theta, y, phi
+  static const Int_t    d1[] = { 1, 0, 0 }, d2[] = { 0, 0, 1 }, d3[] = { 2, 1, 0 };
+  static const Double_t pd1[] = { 0.5, 0.1, -0.02 }, pd2[] = { -0.3 },
+    pd3[] = { 1.2, 0.4 };
+  static const Int_t    t1[] = { 1, 0, 0 }, t2[] = { 0, 0, 0 };
+  static const Double_t pt1[] = { -0.7, 0.05 }, pt2[] = { 0.01, 0.002, 0.0003 };
+  static const Int_t    y1[] = { 0, 1, 0 }, y2[] = { 0, 0, 1 };
+  static const Double_t py1[] = { -0.4, 0.03 }, py2[] = { 0.25 };
+  static const Int_t    p1[] = { 0, 0, 1 }, p2[] = { 1, 1, 0 };
+  static const Double_t pp1[] = { 0.45, -0.02 }, pp2[] = { 0.8 };
+  // YTA/PTA elements: fourth exponent for abs(theta)
+  static const Int_t    ya1[] = { 1, 0, 0, 1 }, ya2[] = { 0, 0, 1, 2 };
+  static const Double_t pya1[] = { 0.6, 0.1 }, pya2[] = { -0.9 };
+  static const Int_t    pa1[] = { 0, 0, 0, 1 }, pa2[] = { 2, 0, 0, 1 };
+  static const Double_t ppa1[] = { 0.15, 0.05 }, ppa2[] = { -1.1 };
+  // Path length elements: exponents of x, theta, y, phi
+  static const Int_t    l1[] = { 0, 0, 0, 0 }, l2[] = { 1, 0, 0, 0 },
+    l3[] = { 0, 1, 0, 0 }, l4[] = { 0, 0, 1, 1 };
+  static const Double_t pl1[] = { 25.0, 0.3, 0.01 }, pl2[] = { 0.5, 0.2 },
+    pl3[] = { -0.8 }, pl4[] = { 0.05, -0.01, 0.002 };
+
+  fDMatrixElems.clear();
+  fDMatrixElems.push_back( MakeElement(3, d1, 3, pd1) );
+  fDMatrixElems.push_back( MakeElement(3, d2, 1, pd2) );
+  fDMatrixElems.push_back( MakeElement(3, d3, 2, pd3) );
+  fTMatrixElems.clear();
+  fTMatrixElems.push_back( MakeElement(3, t1, 2, pt1) );
+  fTMatrixElems.push_back( MakeElement(3, t2, 3, pt2) );
+  fYMatrixElems.clear();
+  fYMatrixElems.push_back( MakeElement(3, y1, 2, py1) );
+  fYMatrixElems.push_back( MakeElement(3, y2, 1, py2) );
+  fPMatrixElems.clear();
+  fPMatrixElems.push_back( MakeElement(3, p1, 2, pp1) );
+  fPMatrixElems.push_back( MakeElement(3, p2, 1, pp2) );
+  fYTAMatrixElems.clear();
+  fYTAMatrixElems.push_back( MakeElement(4, ya1, 2, pya1) );
+  fYTAMatrixElems.push_back( MakeElement(4, ya2, 1, pya2) );
+  fPTAMatrixElems.clear();
+  fPTAMatrixElems.push_back( MakeElement(4, pa1, 2, ppa1) );
+  fPTAMatrixElems.push_back( MakeElement(4, pa2, 1, ppa2) );
+  fLMatrixElems.clear();
+  fLMatrixElems.push_back( MakeElement(4, l1, 3, pl1) );
+  fLMatrixElems.push_back( MakeElement(4, l2, 2, pl2) );
+  fLMatrixElems.push_back( MakeElement(4, l3, 1, pl3) );
+  fLMatrixElems.push_back( MakeElement(4, l4, 3, pl4) );
+
+  // As in ReadDatabase
+  CalcMatrix( 1., fLMatrixElems );
+  CompileOptics();
+}
+
+//_____________________________________________________________________________
+Double_t VDCOpticsTester::CalcTargetVar( const vector<ME_t>& matrix,
+					 const Double_t powers[][5] )
+{
+  // Value of a target variable. The x-dependence is already in the matrix.
+
+  Double_t retval = 0.0;
+  for( vector<ME_t>::const_iterator it=matrix.begin();
+       it!=matrix.end(); ++it )
+    if( it->v != 0.0 ) {
+      Double_t v = it->v;
+      for( vector<int>::size_type i = 0; i < it->pw.size(); ++i )
+	v *= powers[it->pw[i]][i+1];
+      retval += v;
+    }
+  return retval;
+}
+
+//_____________________________________________________________________________
+Double_t VDCOpticsTester::CalcTarget2FPLen( const vector<ME_t>& matrix,
+					    const Double_t powers[][5] )
+{
+  // Distance from the nominal target position to the transport plane
+
+  Double_t retval = 0.0;
+  for( vector<ME_t>::const_iterator it=matrix.begin();
+       it!=matrix.end(); ++it )
+    if( it->v != 0.0 )
+      retval += it->v * powers[it->pw[0]][0]
+		      * powers[it->pw[1]][1]
+		      * powers[it->pw[2]][2]
+		      * powers[it->pw[3]][3];
+  return retval;
+}
+
+//_____________________________________________________________________________
+void VDCOpticsTester::Reference( Double_t x_fp, Double_t th_fp,
+				 Double_t y_fp, Double_t ph_fp,
+				 Double_t* result )
+{
+  // Compute dp, theta, y, phi, pathl, in this order, for one track
+
+  Double_t powers[kNPOW][5];  // { x, th, y, ph, abs(th) }
+  for( Int_t i = 0; i < kNPOW; i++ ) {
+    powers[i][0] = pow( x_fp, i );
+    powers[i][1] = pow( th_fp, i );
+    powers[i][2] = pow( y_fp, i );
+    powers[i][3] = pow( ph_fp, i );
+    powers[i][4] = pow( TMath::Abs(th_fp), i );
+  }
+  CalcMatrix( x_fp, fDMatrixElems );
+  CalcMatrix( x_fp, fTMatrixElems );
+  CalcMatrix( x_fp, fYMatrixElems );
+  CalcMatrix( x_fp, fYTAMatrixElems );
+  CalcMatrix( x_fp, fPMatrixElems );
+  CalcMatrix( x_fp, fPTAMatrixElems );
+
+  result[0] = CalcTargetVar( fDMatrixElems, powers );
+  result[1] = CalcTargetVar( fTMatrixElems, powers );
+  result[2] = CalcTargetVar( fYMatrixElems, powers )
+    + CalcTargetVar( fYTAMatrixElems, powers );
+  result[3] = CalcTargetVar( fPMatrixElems, powers )
+    + CalcTargetVar( fPTAMatrixElems, powers );
+  result[4] = CalcTarget2FPLen( fLMatrixElems, powers );
+}
+
+namespace Podd {
+namespace Tests {
+
+//_____________________________________________________________________________
+VDCOptics::VDCOptics( const char* name, const char* description ) :
+  UnitTest(name,description)
+{
+  // Constructor
+}
+
+//_____________________________________________________________________________
+VDCOptics::~VDCOptics()
+{
+  // Destructor
+}
+
+//_____________________________________________________________________________
+Int_t VDCOptics::ReadDatabase( const TDatime& date )
+{
+  // Initialize test parameters. Tracks with theta of both signs, so that
+  // the abs(theta) terms differ from the theta terms.
+
+  static const Double_t x[]  = { 0.12, -0.35, 0.0,   0.71, -0.05, 0.4,  -0.6 };
+  static const Double_t th[] = { 0.01, -0.02, 0.0,  -0.045, 0.03, 0.015,-0.008};
+  static const Double_t y[]  = {-0.004, 0.01, 0.0,   0.02, -0.015,0.003, 0.007};
+  static const Double_t ph[] = { 0.002,-0.01, 0.0,   0.025, 0.005,-0.02, 0.012};
+  const Int_t n = sizeof(x)/sizeof(x[0]);
+
+  fX.assign( x, x+n );
+  fTh.assign( th, th+n );
+  fY.assign( y, y+n );
+  fPh.assign( ph, ph+n );
+
+  fIsInit = true;
+  return kOK;
+}
+
+//_____________________________________________________________________________
+Int_t VDCOptics::Test()
+{
+  // Reconstruct the test tracks with THaVDC::FocalPlaneToTarget, both as
+  // one batch and one by one, and compare with the per-element evaluation.
+  // Only the summation order differs, so the results must agree to
+  // rounding precision.
+
+  const char* const here = "Test";
+  const Double_t kTol = 1e-12;
+  static const char* const qname[] = { "dp", "theta", "y", "phi", "pathl" };
+
+  if( !fIsInit || !IsOK() ) {
+    Error( Here(here), "Not initialized. Call Init() first." );
+    return -1;
+  }
+
+  VDCOpticsTester vdc;
+  if( vdc.IsZombie() ) {
+    Error( Here(here), "Cannot create VDC" );
+    return 1;
+  }
+  vdc.Setup();
+
+  const Int_t n = fX.size();
+  vector<Double_t> batch( 5*n ), single( 5 );
+  vdc.FocalPlaneToTarget( n, &fX[0], &fTh[0], &fY[0], &fPh[0],
+			  &batch[0], &batch[n], &batch[2*n], &batch[3*n],
+			  &batch[4*n] );
+  Int_t ret = 0;
+  for( Int_t t = 0; t < n; t++ ) {
+    Double_t expect[5];
+    vdc.Reference( fX[t], fTh[t], fY[t], fPh[t], expect );
+    vdc.FocalPlaneToTarget( 1, &fX[t], &fTh[t], &fY[t], &fPh[t],
+			    &single[0], &single[1], &single[2], &single[3],
+			    &single[4] );
+    for( Int_t q = 0; q < 5; q++ ) {
+      Double_t tol = kTol * TMath::Max( 1.0, TMath::Abs(expect[q]) );
+      Double_t vb = batch[q*n+t], vs = single[q];
+      if( fDebug > 0 )
+	Info( Here(here), "track %d %s = %g (expected %g)",
+	      t, qname[q], vb, expect[q] );
+      if( TMath::Abs(vb-expect[q]) > tol ) {
+	Error( Here(here), "track %d of %d: %s = %.15g, expected %.15g",
+	       t, n, qname[q], vb, expect[q] );
+	ret = 2;
+      }
+      if( TMath::Abs(vs-expect[q]) > tol ) {
+	Error( Here(here), "single track %d: %s = %.15g, expected %.15g",
+	       t, qname[q], vs, expect[q] );
+	ret = 3;
+      }
+    }
+  }
+  return ret;
+}
+
+} // namespace Tests
+} // namespace Podd
+
+////////////////////////////////////////////////////////////////////////////////
+
+ClassImp(Podd::Tests::VDCOptics)
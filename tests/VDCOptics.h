@@ -0,0 +1,43 @@
+#ifndef Podd_Tests_VDCOptics
+#define Podd_Tests_VDCOptics
+
+///////////////////////////////////////////////////////////////////////////////
+//                                                                           //
+// VDCOptics unit test                                                       //
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#include "UnitTest.h"
+#include <vector>
+
+namespace Podd {
+namespace Tests {
+
+class VDCOptics : public UnitTest {
+
+public:
+  VDCOptics( const char* name = "vdc_optics",
+	     const char* description = "VDC optics unit test" );
+  virtual ~VDCOptics();
+
+  virtual Int_t Test();
+
+protected:
+
+  // Test data: focal plane coordinates of a batch of tracks
+  std::vector<Double_t> fX;
+  std::vector<Double_t> fTh;
+  std::vector<Double_t> fY;
+  std::vector<Double_t> fPh;
+
+  virtual Int_t  ReadDatabase( const TDatime& date );
+
+  ClassDef(VDCOptics,0)   // VDC optics tables vs. per-element evaluation
+};
+
+} // namespace Tests
+} // namespace Podd
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif
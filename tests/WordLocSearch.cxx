@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+//                                                                           //
+// WordLocSearch - Compare the header word searches of WordLoc::Load and     //
+//                 MultiWordLoc::Load on a synthetic crate buffer            //
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#include "WordLocSearch.h"
+#include "BdataLoc.h"
+#include "THaEvData.h"
+#include "TString.h"
+#include <vector>
+
+using namespace std;
+
+static const Int_t  kCrate = 5;
+static const UInt_t kHdr1  = 0xABCD1234;   // Repeated, also at unaligned bytes
+static const UInt_t kHdr2  = 0xCAFE0001;   // Close to the end of the crate
+static const UInt_t kHdr3  = 0x55AA55AA;   // Not in the data
+static const UInt_t kHdr4  = 0xBEEF0042;   // Near the end, after kHdr2
+
+// Header searches: header, words to skip, expected data (0: none)
+struct SearchDef_t {
+  UInt_t header;
+  Int_t  ntoskip;
+  UInt_t expect;
+};
+static const SearchDef_t searches[] = {
+  { kHdr1, 1, 0xD1 },   // First aligned occurrence, not the duplicate
+  { kHdr1, 2, 0xD2 },
+  { kHdr1, 5, 0xE1 },   // Duplicate header: still relative to the first one
+  { kHdr2, 1, 0xF1 },
+  { kHdr2, 4, 0    },   // Beyond the end of the crate
+  { kHdr3, 1, 0    },
+  { kHdr4, 1, 0xF2 },   // Last word of the crate
+  { kHdr4, 2, 0    },
+  { 0, 0, 0 }
+};
+
+//_____________________________________________________________________________
+class CrateBuffer : public THaEvData {
+  // Decoder with a single crate whose data are the given words
+public:
+  CrateBuffer( Int_t crate, const vector<UInt_t>& data ) {
+    buffer = &data[0];
+    rocdat[crate].pos = 0;
+    rocdat[crate].len = data.size();
+  }
+  virtual Int_t LoadEvent( const UInt_t* ) { return HED_OK; }
+};
+
+namespace Podd {
+namespace Tests {
+
+//_____________________________________________________________________________
+WordLocSearch::WordLocSearch( const char* name, const char* description ) :
+  UnitTest(name,description)
+{
+  // Constructor
+}
+
+//_____________________________________________________________________________
+WordLocSearch::~WordLocSearch()
+{
+  // Destructor
+}
+
+//_____________________________________________________________________________
+Int_t WordLocSearch::ReadDatabase( const TDatime& date )
+{
+  // Set up the crate data. On little-endian machines, words 0 and 1
+  // contain the bytes of kHdr1 at an unaligned byte offset, and word 2
+  // contains its first byte at an unaligned offset. The first aligned
+  // kHdr1 is at word 5, which is not a multiple of 4 words.
+
+  static const UInt_t data[] = {
+    0x12340000, 0x0000ABCD, 0x00003400, 0x11111111, 0x34343434,
+    kHdr1,      0xD1,       0xD2,       0x22222222, kHdr1,
+    0xE1,       0x33333333, kHdr2,      0xF1,       kHdr4,
+    0xF2
+  };
+  fCrateData.assign( data, data+sizeof(data)/sizeof(data[0]) );
+
+  fIsInit = true;
+  return kOK;
+}
+
+//_____________________________________________________________________________
+Int_t WordLocSearch::Test()
+{
+  // Search for the headers in the synthetic crate data, once with a
+  // separate WordLoc::Load per header and once with all headers in one
+  // MultiWordLoc. Both must find the same data, which must be the words
+  // at the given offset from the first word-aligned header, if within the
+  // crate.
+
+  const char* const here = "Test";
+
+  if( !fIsInit || !IsOK() ) {
+    Error( Here(here), "Not initialized. Call Init() first." );
+    return -1;
+  }
+
+  CrateBuffer evdata( kCrate, fCrateData );
+
+  vector<WordLoc*> single, multi;
+  MultiWordLoc group( kCrate );
+  for( const SearchDef_t* s = searches; s->header; ++s ) {
+    TString name = Form("hdr%x_%d", s->header, s->ntoskip);
+    single.push_back( new WordLoc(name, kCrate, s->header, s->ntoskip) );
+    multi.push_back( new WordLoc(name, kCrate, s->header, s->ntoskip) );
+    group.Add( multi.back() );
+  }
+  group.Init();
+
+  for( vector<WordLoc*>::size_type i = 0; i < single.size(); i++ ) {
+    single[i]->Clear();
+    single[i]->Load( evdata );
+    multi[i]->Clear();
+  }
+  group.Load( evdata );
+
+  Int_t ret = 0;
+  for( vector<WordLoc*>::size_type i = 0; i < single.size(); i++ ) {
+    const SearchDef_t& s = searches[i];
+    Bool_t found = (s.expect != 0);
+    const char* name = single[i]->GetName();
+    if( fDebug > 0 )
+      Info( Here(here), "%s: WordLoc %s 0x%x, MultiWordLoc %s 0x%x", name,
+	    single[i]->DidLoad() ? "found" : "no data",
+	    single[i]->DidLoad() ? single[i]->Get() : 0,
+	    multi[i]->DidLoad() ? "found" : "no data",
+	    multi[i]->DidLoad() ? multi[i]->Get() : 0 );
+    if( single[i]->DidLoad() != found ||
+	(found && single[i]->Get() != s.expect) ) {
+      Error( Here(here), "WordLoc %s: wrong result, expected %s 0x%x",
+	     name, found ? "data" : "no data", s.expect );
+      ret = 1;
+    }
+    if( multi[i]->DidLoad() != single[i]->DidLoad() ||
+	(multi[i]->DidLoad() && multi[i]->Get() != single[i]->Get()) ) {
+      Error( Here(here), "MultiWordLoc %s: result differs from WordLoc",
+	     name );
+      ret = 2;
+    }
+    delete single[i];
+    delete multi[i];
+  }
+  return ret;
+}
+
+} // namespace Tests
+} // namespace Podd
+
+////////////////////////////////////////////////////////////////////////////////
+
+ClassImp(Podd::Tests::WordLocSearch)
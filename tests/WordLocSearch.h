@@ -0,0 +1,40 @@
+#ifndef Podd_Tests_WordLocSearch
+#define Podd_Tests_WordLocSearch
+
+///////////////////////////////////////////////////////////////////////////////
+//                                                                           //
+// WordLocSearch unit test                                                   //
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#include "UnitTest.h"
+#include <vector>
+
+namespace Podd {
+namespace Tests {
+
+class WordLocSearch : public UnitTest {
+
+public:
+  WordLocSearch( const char* name = "wordloc_search",
+		 const char* description = "Header word search unit test" );
+  virtual ~WordLocSearch();
+
+  virtual Int_t Test();
+
+protected:
+
+  // Test data
+  std::vector<UInt_t> fCrateData;   // Synthetic crate buffer
+
+  virtual Int_t  ReadDatabase( const TDatime& date );
+
+  ClassDef(WordLocSearch,0)   // WordLoc vs. MultiWordLoc header search
+};
+
+} // namespace Tests
+} // namespace Podd
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif